@@ -73,6 +73,7 @@
       ],
       'sources': [
         'ext/snowcrash/ext/markdown-parser/test/test-ByteBuffer.cc',
+        'ext/snowcrash/ext/markdown-parser/test/test-MarkdownNode.cc',
         'ext/snowcrash/ext/markdown-parser/test/test-MarkdownParser.cc',
         'ext/snowcrash/ext/markdown-parser/test/test-libmarkdownparser.cc'
       ],
@@ -103,16 +104,23 @@
         'ext/snowcrash/src/MSONValueMemberParser.cc',
         'ext/snowcrash/src/Blueprint.cc',
         'ext/snowcrash/src/BlueprintSourcemap.cc',
+        'ext/snowcrash/src/DependencyGraph.cc',
+        'ext/snowcrash/src/DependencyGraph.h',
         'ext/snowcrash/src/Section.cc',
         'ext/snowcrash/src/Section.h',
         'ext/snowcrash/src/Signature.cc',
         'ext/snowcrash/src/Signature.h',
+        'ext/snowcrash/src/SourceMapUtility.cc',
+        'ext/snowcrash/src/SourceMapUtility.h',
+        'ext/snowcrash/src/Tracing.cc',
+        'ext/snowcrash/src/Tracing.h',
         'ext/snowcrash/src/snowcrash.cc',
         'ext/snowcrash/src/snowcrash.h',
         'ext/snowcrash/src/UriTemplateParser.cc',
         'ext/snowcrash/src/UriTemplateParser.h',
         'ext/snowcrash/src/PayloadParser.h',
         'ext/snowcrash/src/SectionParserData.h',
+        'ext/snowcrash/src/ParseStatistics.h',
         'ext/snowcrash/src/ActionParser.h',
         'ext/snowcrash/src/AssetParser.h',
         'ext/snowcrash/src/AttributesParser.h',
@@ -173,8 +181,8 @@
         'ext/snowcrash/test/test-AttributesParser.cc',
         'ext/snowcrash/test/test-Blueprint.cc',
         'ext/snowcrash/test/test-BlueprintParser.cc',
-        'ext/snowcrash/test/test-BlueprintUtility.cc',
         'ext/snowcrash/test/test-DataStructureGroupParser.cc',
+        'ext/snowcrash/test/test-DependencyGraph.cc',
         'ext/snowcrash/test/test-HeadersParser.cc',
         'ext/snowcrash/test/test-Indentation.cc',
         'ext/snowcrash/test/test-ModelTable.cc',
@@ -197,6 +205,7 @@
         'ext/snowcrash/test/test-Signature.cc',
         'ext/snowcrash/test/test-StringUtility.cc',
         'ext/snowcrash/test/test-SymbolIdentifier.cc',
+        'ext/snowcrash/test/test-Tracing.cc',
         'ext/snowcrash/test/test-UriTemplateParser.cc',
         'ext/snowcrash/test/test-ValuesParser.cc',
         'ext/snowcrash/test/test-Warnings.cc',
@@ -281,6 +290,7 @@
         "src/RefractElementFactory.cc",
         "src/ConversionContext.cc",
         "src/ConversionContext.h",
+        "src/StageClock.h",
         "src/ElementInfoUtils.h"
         "src/ElementComparator.h"
 
@@ -298,6 +308,8 @@
         # librefract parts - will be separated into other project
         "src/refract/Utils.h",
         "src/refract/Utils.cc",
+        "src/refract/Hash.h",
+        "src/refract/Hash.cc",
         "src/refract/InfoElements.h",
         "src/refract/InfoElements.cc",
         "src/refract/InfoElementsUtils.h",
@@ -401,10 +413,13 @@
 
         "test/utils/test-Variant.cc",
         "test/utils/test-Utf8.cc",
+        "test/utils/log/test-Trivial.cc",
         "test/utils/so/test-JsonIo.cc",
         "test/utils/so/test-YamlIo.cc",
 
         "test/refract/test-Utils.cc",
+        "test/refract/test-Hash.cc",
+        "test/refract/test-Registry.cc",
         "test/refract/test-JsonSchema.cc",
 
         "test/refract/dsd/test-Array.cc",
@@ -438,6 +453,71 @@
       ],
     },
 
+# PERF-LIBDRAFTER
+    {
+      'target_name': 'perf-libdrafter',
+      'type': 'executable',
+      "conditions" : [
+        [ 'libdrafter_type=="static_library"', { 'defines' : [ 'DRAFTER_BUILD_STATIC' ] }],
+      ],
+      'include_dirs': [
+        'test/performance',
+      ],
+      'sources': [
+        'test/performance/perf-drafter.cc',
+        'test/performance/CommandLine.h',
+        'test/performance/CommandLine.cc',
+        'test/performance/AllocationCounter.h',
+        'test/performance/AllocationCounter.cc',
+        'test/performance/Pipeline.h',
+        'test/performance/Pipeline.cc',
+        'test/performance/SyntheticBlueprint.h',
+        'test/performance/SyntheticBlueprint.cc',
+      ],
+      'dependencies': [
+        'libdrafter',
+      ]
+    },
+
+# TEST-ALLOCATIONS
+    {
+      'target_name': 'test-allocations',
+      'type': 'executable',
+      "conditions" : [
+        [ 'libdrafter_type=="static_library"', { 'defines' : [ 'DRAFTER_BUILD_STATIC' ] }],
+      ],
+      'include_dirs': [
+        'test/performance',
+      ],
+      'sources': [
+        'test/performance/test-allocations.cc',
+        'test/performance/CommandLine.h',
+        'test/performance/CommandLine.cc',
+        'test/performance/AllocationCounter.h',
+        'test/performance/AllocationCounter.cc',
+        'test/performance/Pipeline.h',
+        'test/performance/Pipeline.cc',
+        'test/performance/SyntheticBlueprint.h',
+        'test/performance/SyntheticBlueprint.cc',
+      ],
+      'dependencies': [
+        'libdrafter',
+      ]
+    },
+
+# GENERATE-BLUEPRINT
+    {
+      'target_name': 'generate-blueprint',
+      'type': 'executable',
+      'sources': [
+        'test/performance/generate-blueprint.cc',
+        'test/performance/CommandLine.h',
+        'test/performance/CommandLine.cc',
+        'test/performance/SyntheticBlueprint.h',
+        'test/performance/SyntheticBlueprint.cc',
+      ],
+    },
+
 # DRAFTER
     {
       "target_name": "drafter",
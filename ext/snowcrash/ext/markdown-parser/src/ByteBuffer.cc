@@ -6,6 +6,9 @@
 //  Copyright (c) 2014 Apiary Inc. All rights reserved.
 //
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include "ByteBuffer.h"
 
 using namespace mdp;
@@ -108,6 +111,258 @@ void mdp::BuildCharacterIndex(ByteBufferCharacterIndex& index, const ByteBuffer&
     }
 }
 
+/* Word of bytes scanned at once */
+typedef uint64_t ScanWord;
+
+/* Word with all bytes set to the byte */
+#define SCAN_WORD_BROADCAST(byte) (~ScanWord(0) / 0xFF * (byte))
+
+/* Non-zero if any of the bytes of the word is zero */
+#define SCAN_WORD_HAS_ZERO(word) (((word)-SCAN_WORD_BROADCAST(0x01)) & ~(word)&SCAN_WORD_BROADCAST(0x80))
+
+/* Non-zero if any of the bytes of the word equals the byte */
+#define SCAN_WORD_HAS_BYTE(word, byte) SCAN_WORD_HAS_ZERO((word) ^ SCAN_WORD_BROADCAST(byte))
+
+/* True if the word contains only ASCII characters that do not need a closer look */
+static bool IsPlainScanWord(ScanWord word)
+{
+    return !(word & SCAN_WORD_BROADCAST(0x80)) && !SCAN_WORD_HAS_ZERO(word) && !SCAN_WORD_HAS_BYTE(word, '\t')
+        && !SCAN_WORD_HAS_BYTE(word, '\r');
+}
+
+void mdp::ScanByteBuffer(ByteBufferScan& scan, const ByteBuffer& byteBuffer)
+{
+    const char* source = byteBuffer.c_str();
+    size_t len = byteBuffer.length();
+
+    size_t pos = 0;
+    size_t charPos = 0;
+    size_t charBytes = 0; // remaining bytes of the current character
+    bool indexing = true; // the character index ends at the first NUL character
+
+    scan = ByteBufferScan();
+    scan.characterIndex.resize(len);
+
+    while (pos < len) {
+
+        // Skip a word of plain ASCII characters at once
+        if (indexing && charBytes == 0 && pos + sizeof(ScanWord) <= len) {
+
+            ScanWord word;
+            std::memcpy(&word, source + pos, sizeof(ScanWord));
+
+            if (IsPlainScanWord(word)) {
+
+                for (size_t i = 0; i < sizeof(ScanWord); ++i) {
+                    scan.characterIndex[pos++] = charPos++;
+                }
+
+                continue;
+            }
+        }
+
+        const char byte = source[pos];
+
+        if (byte == '\t') {
+            if (scan.firstTab == ByteBuffer::npos)
+                scan.firstTab = pos;
+        } else if (byte == '\r') {
+            if (scan.firstCarriageReturn == ByteBuffer::npos)
+                scan.firstCarriageReturn = pos;
+        }
+
+        if (indexing) {
+
+            // UTF8 lead byte
+            if (charBytes == 0) {
+
+                if (byte) {
+                    charBytes = UTF8_CHAR_LEN(byte);
+                    charPos++;
+                } else {
+                    indexing = false;
+                }
+            }
+
+            if (indexing) {
+                scan.characterIndex[pos] = charPos - 1;
+                charBytes--;
+            }
+        }
+
+        ++pos;
+    }
+}
+
+/* Number of UTF8 characters in the bytes */
+static size_t CountCharacters(const char* s, size_t len)
+{
+    size_t count = 0;
+
+    for (size_t i = 0; i < len; ++i) {
+        // Not an UTF8 continuation byte
+        if ((s[i] & 0xC0) != 0x80)
+            count++;
+    }
+
+    return count;
+}
+
+/*
+ * Normalize the byte buffer. If the character index of the original byte buffer is given,
+ * the character index of the normalized one is built from it.
+ */
+static void Normalize(ByteBuffer& normalized,
+    ByteBufferOffsetTable& table,
+    ByteBufferCharacterIndex* normalizedIndex,
+    const ByteBuffer& byteBuffer,
+    const ByteBufferCharacterIndex* index)
+{
+    size_t len = byteBuffer.length();
+    size_t pos = 0;
+    size_t column = 0; // characters of the current line in the normalized buffer
+    std::ptrdiff_t offset = 0;
+    bool indexing = true; // the character index ends at the first NUL character
+
+    normalized.clear();
+    normalized.reserve(len);
+    table.clear();
+
+    if (normalizedIndex) {
+        normalizedIndex->clear();
+        normalizedIndex->reserve(len);
+    }
+
+    // Replaced bytes are single byte characters, so the offset applies to characters as well
+    auto indexBytes = [&](size_t location, size_t count) {
+        if (!normalizedIndex)
+            return;
+
+        for (size_t i = 0; i < count; ++i) {
+            if (indexing && !byteBuffer[location + i])
+                indexing = false;
+
+            normalizedIndex->push_back(indexing ? (*index)[location + i] - offset : 0);
+        }
+    };
+
+    while (pos < len) {
+
+        size_t next = byteBuffer.find_first_of("\t\r\n", pos);
+        size_t end = next == ByteBuffer::npos ? len : next;
+
+        normalized.append(byteBuffer, pos, end - pos);
+        indexBytes(pos, end - pos);
+        column += CountCharacters(byteBuffer.c_str() + pos, end - pos);
+
+        if (next == ByteBuffer::npos)
+            break;
+
+        pos = next + 1;
+
+        if (byteBuffer[next] == '\t') {
+
+            size_t width = NormalizedTabWidth - column % NormalizedTabWidth;
+
+            if (normalizedIndex) {
+                for (size_t i = 0; i < width; ++i) {
+                    normalizedIndex->push_back(indexing ? (*index)[next] - offset + i : 0);
+                }
+            }
+
+            if (width != 1) {
+                offset += 1 - static_cast<std::ptrdiff_t>(width);
+                table.push_back({ normalized.length(), width, 1, offset });
+            }
+
+            normalized.append(width, ' ');
+            column += width;
+            continue;
+        }
+
+        indexBytes(next, 1);
+
+        // CRLF
+        if (byteBuffer[next] == '\r' && pos < len && byteBuffer[pos] == '\n') {
+            ++pos;
+            ++offset;
+            table.push_back({ normalized.length(), 1, 2, offset });
+        }
+
+        normalized += '\n';
+        column = 0;
+    }
+}
+
+void mdp::NormalizeByteBuffer(ByteBuffer& normalized, ByteBufferOffsetTable& table, const ByteBuffer& byteBuffer)
+{
+    Normalize(normalized, table, nullptr, byteBuffer, nullptr);
+}
+
+void mdp::NormalizeByteBuffer(ByteBuffer& normalized,
+    ByteBufferOffsetTable& table,
+    ByteBufferCharacterIndex& normalizedIndex,
+    const ByteBuffer& byteBuffer,
+    const ByteBufferCharacterIndex& index)
+{
+    Normalize(normalized, table, &normalizedIndex, byteBuffer, &index);
+}
+
+/* Translate a location of the normalized byte buffer to the original one */
+static size_t TranslateLocation(size_t location, bool isEnd, const ByteBufferOffsetTable& table)
+{
+    // Last replacement starting before the location, or at it unless translating an end
+    ByteBufferOffsetTable::const_iterator it = std::upper_bound(table.begin(),
+        table.end(),
+        location,
+        [isEnd](size_t value, const ByteBufferReplacement& replacement) {
+            return isEnd ? value <= replacement.location : value < replacement.location;
+        });
+
+    if (it == table.begin())
+        return location;
+
+    const ByteBufferReplacement& replacement = *--it;
+    size_t replacementEnd = replacement.location + replacement.length;
+
+    if (location >= replacementEnd)
+        return location + replacement.offset;
+
+    // Within the replacement, map to the replaced bytes as a whole
+    if (location == replacement.location && !isEnd)
+        return replacement.location + replacement.offset + replacement.length - replacement.originalLength;
+
+    return replacementEnd + replacement.offset;
+}
+
+BytesRange mdp::TranslateBytesRange(const BytesRange& range, const ByteBufferOffsetTable& table)
+{
+    if (table.empty())
+        return range;
+
+    size_t location = TranslateLocation(range.location, false, table);
+    size_t end = TranslateLocation(range.location + range.length, true, table);
+
+    return BytesRange(location, end > location ? end - location : 0);
+}
+
+BytesRangeSet mdp::CharactersRangeSetToBytesRangeSet(
+    const CharactersRangeSet& rangeSet, const ByteBufferCharacterIndex& index)
+{
+    BytesRangeSet byteMap;
+
+    for (CharactersRangeSet::const_iterator it = rangeSet.begin(); it != rangeSet.end(); ++it) {
+
+        // First byte of the character, the index is ordered
+        size_t location = std::lower_bound(index.begin(), index.end(), it->location) - index.begin();
+        size_t end = std::lower_bound(index.begin(), index.end(), it->location + it->length) - index.begin();
+
+        byteMap.push_back(BytesRange(location, end - location));
+    }
+
+    return byteMap;
+}
+
 CharactersRangeSet mdp::BytesRangeSetToCharactersRangeSet(const BytesRangeSet& rangeSet, const ByteBuffer& byteBuffer)
 {
     CharactersRangeSet characterMap;
@@ -9,6 +9,7 @@
 #ifndef MARKDOWNPARSER_BYTEBUFFER_H
 #define MARKDOWNPARSER_BYTEBUFFER_H
 
+#include <cstddef>
 #include <string>
 #include <vector>
 #include <sstream>
@@ -76,6 +77,67 @@ namespace mdp
     /** Fill character map - cache of characters positions */
     void BuildCharacterIndex(ByteBufferCharacterIndex& index, const ByteBuffer& byteBuffer);
 
+    /** Result of scanning a byte buffer */
+    struct ByteBufferScan {
+        /** Position of the first tab '\t', ByteBuffer::npos if none */
+        size_t firstTab = ByteBuffer::npos;
+
+        /** Position of the first carriage return '\r', ByteBuffer::npos if none */
+        size_t firstCarriageReturn = ByteBuffer::npos;
+
+        /** Map of bytes to characters, same as built by %BuildCharacterIndex */
+        ByteBufferCharacterIndex characterIndex;
+    };
+
+    /**
+     *  \brief Scan the byte buffer in a single pass
+     *
+     *  Finds the first tab and carriage return and builds the character index.
+     */
+    void ScanByteBuffer(ByteBufferScan& scan, const ByteBuffer& byteBuffer);
+
+    /** Width of a tab stop used when normalizing a byte buffer */
+    const size_t NormalizedTabWidth = 4;
+
+    /** Bytes of the original byte buffer replaced in the normalized one */
+    struct ByteBufferReplacement {
+        size_t location;       /// < Location of the replacement in the normalized buffer
+        size_t length;         /// < Length of the replacement in the normalized buffer
+        size_t originalLength; /// < Length of the replaced bytes in the original buffer
+        std::ptrdiff_t offset; /// < Original minus normalized location of the bytes following the replacement
+    };
+
+    /** Offset translation table - replacements changing the length, ordered by location */
+    typedef std::vector<ByteBufferReplacement> ByteBufferOffsetTable;
+
+    /**
+     *  \brief Normalize tabs and line endings of the byte buffer
+     *
+     *  Tabs are expanded with spaces to the next tab stop, CRLF and CR line
+     *  endings are replaced with LF. Replacements changing the length are
+     *  recorded in the offset table.
+     */
+    void NormalizeByteBuffer(ByteBuffer& normalized, ByteBufferOffsetTable& table, const ByteBuffer& byteBuffer);
+
+    /**
+     *  \brief Normalize the byte buffer, building the character index of the normalized one
+     *
+     *  The index is derived from \p index, the character index of the original byte buffer
+     *  built by %ScanByteBuffer, so the normalized byte buffer does not need to be scanned.
+     */
+    void NormalizeByteBuffer(ByteBuffer& normalized,
+        ByteBufferOffsetTable& table,
+        ByteBufferCharacterIndex& normalizedIndex,
+        const ByteBuffer& byteBuffer,
+        const ByteBufferCharacterIndex& index);
+
+    /** Translate a range of bytes of the normalized byte buffer to the original one */
+    BytesRange TranslateBytesRange(const BytesRange& range, const ByteBufferOffsetTable& table);
+
+    /** Convert ranges of characters to ranges of bytes */
+    BytesRangeSet CharactersRangeSetToBytesRangeSet(
+        const CharactersRangeSet& rangeSet, const ByteBufferCharacterIndex& index);
+
     /** Convert ranges of bytes to ranges of characters */
     CharactersRangeSet BytesRangeSetToCharactersRangeSet(const BytesRangeSet& rangeSet, const ByteBuffer& byteBuffer);
     CharactersRangeSet BytesRangeSetToCharactersRangeSet(
@@ -13,7 +13,6 @@ using namespace mdp;
 MarkdownNode::MarkdownNode(MarkdownNodeType type_, MarkdownNode* parent_, const ByteBuffer& text_, const Data& data_)
     : type(type_), text(text_), data(data_), m_parent(parent_)
 {
-    m_children.reset(::new MarkdownNodes);
 }
 
 MarkdownNode::MarkdownNode(const MarkdownNode& rhs)
@@ -22,18 +21,47 @@ MarkdownNode::MarkdownNode(const MarkdownNode& rhs)
     this->text = rhs.text;
     this->data = rhs.data;
     this->sourceMap = rhs.sourceMap;
-    this->m_children.reset(::new MarkdownNodes(*rhs.m_children.get()));
+    if (rhs.m_children.get())
+        this->m_children.reset(::new MarkdownNodes(*rhs.m_children.get()));
     this->m_parent = rhs.m_parent;
+    adoptChildren();
+}
+
+MarkdownNode::MarkdownNode(MarkdownNode&& rhs) noexcept
+    : type(rhs.type),
+      text(std::move(rhs.text)),
+      data(rhs.data),
+      sourceMap(std::move(rhs.sourceMap)),
+      m_parent(rhs.m_parent),
+      m_children(std::move(rhs.m_children))
+{
+    adoptChildren();
 }
 
 MarkdownNode& MarkdownNode::operator=(const MarkdownNode& rhs)
 {
+    if (this == &rhs)
+        return *this;
+
     this->type = rhs.type;
     this->text = rhs.text;
     this->data = rhs.data;
     this->sourceMap = rhs.sourceMap;
-    this->m_children.reset(::new MarkdownNodes(*rhs.m_children.get()));
+    this->m_children.reset(rhs.m_children.get() ? ::new MarkdownNodes(*rhs.m_children.get()) : NULL);
+    this->m_parent = rhs.m_parent;
+    adoptChildren();
+    return *this;
+}
+
+MarkdownNode& MarkdownNode::operator=(MarkdownNode&& rhs) noexcept
+{
+    this->type = rhs.type;
+    this->text = std::move(rhs.text);
+    this->data = rhs.data;
+    this->sourceMap = std::move(rhs.sourceMap);
+    this->m_children = std::move(rhs.m_children);
     this->m_parent = rhs.m_parent;
+    adoptChildren();
     return *this;
 }
 
@@ -66,19 +94,31 @@ bool MarkdownNode::hasParent() const
 MarkdownNodes& MarkdownNode::children()
 {
     if (!m_children.get())
-        throw "no children set";
+        m_children.reset(::new MarkdownNodes);
 
     return *m_children;
 }
 
 const MarkdownNodes& MarkdownNode::children() const
 {
+    static const MarkdownNodes none;
+
     if (!m_children.get())
-        throw "no children set";
+        return none;
 
     return *m_children;
 }
 
+void MarkdownNode::adoptChildren()
+{
+    if (!m_children.get())
+        return;
+
+    for (MarkdownNodes::iterator it = m_children->begin(); it != m_children->end(); ++it) {
+        it->m_parent = this;
+    }
+}
+
 void MarkdownNode::printNode(size_t level) const
 {
     using std::cout;
@@ -136,7 +176,7 @@ void MarkdownNode::printNode(size_t level) const
 
     cout << std::endl;
 
-    for (MarkdownNodeIterator it = m_children->begin(); it != m_children->end(); ++it) {
+    for (MarkdownNodes::const_iterator it = children().begin(); it != children().end(); ++it) {
         it->printNode(level + 1);
     }
 
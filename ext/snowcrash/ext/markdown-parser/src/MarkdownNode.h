@@ -72,7 +72,14 @@ namespace mdp
         /** True if section's parent is specified, false otherwise */
         bool hasParent() const;
 
-        /** Children nodes */
+        /**
+         *  Children nodes
+         *
+         *  The collection is allocated on first modifying access,
+         *  childless nodes share a single empty collection. Only the
+         *  builder modifies a node, parsers read the AST through const
+         *  iterators so that concurrent reads never allocate.
+         */
         MarkdownNodes& children();
         const MarkdownNodes& children() const;
 
@@ -85,9 +92,15 @@ namespace mdp
         /** Copy constructor */
         MarkdownNode(const MarkdownNode& rhs);
 
+        /** Move constructor */
+        MarkdownNode(MarkdownNode&& rhs) noexcept;
+
         /** Assignment operator */
         MarkdownNode& operator=(const MarkdownNode& rhs);
 
+        /** Move assignment operator */
+        MarkdownNode& operator=(MarkdownNode&& rhs) noexcept;
+
         /** Destructor */
         ~MarkdownNode();
 
@@ -97,10 +110,13 @@ namespace mdp
     private:
         MarkdownNode* m_parent;
         std::unique_ptr<MarkdownNodes> m_children;
+
+        /** Points children back to this node */
+        void adoptChildren();
     };
 
-    /** Markdown AST nodes collection iterator */
-    typedef MarkdownNodes::iterator MarkdownNodeIterator;
+    /** Markdown AST nodes collection iterator, read only */
+    typedef MarkdownNodes::const_iterator MarkdownNodeIterator;
 }
 
 #endif
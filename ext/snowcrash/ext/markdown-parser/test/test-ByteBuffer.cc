@@ -180,3 +180,116 @@ TEST_CASE("Byte buffer and Index should return equal char ranges", "[bytebuffer]
     REQUIRE(charMap[4].location == indexMap[4].location);
     REQUIRE(charMap[4].length == indexMap[4].length);
 }
+
+TEST_CASE("Scan byte buffer in a single pass", "[bytebuffer]")
+{
+    // "# Ni Hao API ..." with a Czech word, a tab and a CRLF
+    ByteBuffer src = "# \xE4\xBD\xA0\xE5\xA5\xBD API with a long enough line\n\n+ p\xC5\x99\xC3\xADklad\tend\r\n";
+
+    ByteBufferScan scan;
+    ScanByteBuffer(scan, src);
+
+    ByteBufferCharacterIndex index;
+    BuildCharacterIndex(index, src);
+
+    REQUIRE(scan.characterIndex == index);
+
+    REQUIRE(scan.firstTab == src.find('\t'));
+    REQUIRE(scan.firstCarriageReturn == src.find('\r'));
+
+    SECTION("Plain source")
+    {
+        src = "# API\n\nno tabs or carriage returns here";
+        ScanByteBuffer(scan, src);
+        BuildCharacterIndex(index, src);
+
+        REQUIRE(scan.characterIndex == index);
+        REQUIRE(scan.firstTab == ByteBuffer::npos);
+        REQUIRE(scan.firstCarriageReturn == ByteBuffer::npos);
+    }
+}
+
+TEST_CASE("Normalize byte buffer and translate ranges back", "[bytebuffer][sourcemap]")
+{
+    ByteBuffer src = "a\tb\r\n\xC5\x99\tc\rd\r\n";
+
+    ByteBuffer normalized;
+    ByteBufferOffsetTable table;
+    NormalizeByteBuffer(normalized, table, src);
+
+    REQUIRE(normalized == "a   b\n\xC5\x99   c\nd\n");
+    REQUIRE(table.size() == 4);
+
+    // The whole buffer
+    BytesRange range = TranslateBytesRange(BytesRange(0, normalized.length()), table);
+    REQUIRE(range.location == 0);
+    REQUIRE(range.length == src.length());
+
+    // "b\n" is "b\r\n"
+    range = TranslateBytesRange(BytesRange(4, 2), table);
+    REQUIRE(range.location == 2);
+    REQUIRE(range.length == 3);
+
+    // The expanded tab is the tab
+    range = TranslateBytesRange(BytesRange(8, 3), table);
+    REQUIRE(range.location == 7);
+    REQUIRE(range.length == 1);
+
+    // "c\nd" follows a CR line ending of the same length
+    BytesRangeSet rangeSet;
+    rangeSet.push_back(TranslateBytesRange(BytesRange(11, 3), table));
+    REQUIRE(MapBytesRangeSet(rangeSet, src) == "c\rd");
+
+    SECTION("Characters to bytes")
+    {
+        ByteBufferScan scan;
+        ScanByteBuffer(scan, normalized);
+
+        CharactersRangeSet characters;
+        characters.push_back(CharactersRange(5, 2));
+
+        BytesRangeSet bytes = CharactersRangeSetToBytesRangeSet(characters, scan.characterIndex);
+        REQUIRE(bytes.size() == 1);
+        REQUIRE(bytes[0].location == 5);
+        REQUIRE(bytes[0].length == 3);
+    }
+}
+
+TEST_CASE("Normalize byte buffer building its character index", "[bytebuffer][sourcemap]")
+{
+    ByteBuffer src = "a\tb\r\n\xC5\x99\tc\rd\r\n\xE4\xBD\xA0\t\t\xC5\x99";
+
+    ByteBufferScan scan;
+    ScanByteBuffer(scan, src);
+
+    ByteBuffer normalized;
+    ByteBufferOffsetTable table;
+    ByteBufferCharacterIndex index;
+    NormalizeByteBuffer(normalized, table, index, src, scan.characterIndex);
+
+    REQUIRE(normalized == "a   b\n\xC5\x99   c\nd\n\xE4\xBD\xA0       \xC5\x99");
+    REQUIRE(table.size() == 6);
+
+    ByteBufferScan normalizedScan;
+    ScanByteBuffer(normalizedScan, normalized);
+    REQUIRE(index == normalizedScan.characterIndex);
+
+    SECTION("Many tabs in a line")
+    {
+        src.clear();
+
+        for (size_t i = 0; i < 1000; ++i) {
+            src += "\xC5\x99\t";
+        }
+
+        ScanByteBuffer(scan, src);
+        NormalizeByteBuffer(normalized, table, index, src, scan.characterIndex);
+
+        // Every tab is expanded by 3 spaces
+        REQUIRE(normalized.length() == 5000);
+        REQUIRE(normalized.substr(4995) == "\xC5\x99   ");
+
+        ScanByteBuffer(normalizedScan, normalized);
+        REQUIRE(index == normalizedScan.characterIndex);
+    }
+}
@@ -0,0 +1,94 @@
+//
+//  test-MarkdownNode.cc
+//  markdownparser
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#include <utility>
+
+#include "catch.hpp"
+#include "MarkdownNode.h"
+
+using namespace mdp;
+
+namespace
+{
+    /** Build a root with a list item of two paragraphs, the way the parser does */
+    void buildList(MarkdownNode& ast)
+    {
+        ast.type = RootMarkdownNodeType;
+        ast.children().emplace_back(ListItemMarkdownNodeType, &ast);
+
+        MarkdownNode& item = ast.children().back();
+        item.children().emplace_back(ParagraphMarkdownNodeType, &item, "item");
+        item.children().emplace_back(ParagraphMarkdownNodeType, &item, "nested");
+    }
+}
+
+TEST_CASE("Moved node is the parent of its children", "[markdownnode]")
+{
+    MarkdownNode ast;
+    buildList(ast);
+
+    MarkdownNode& item = ast.children().front();
+    const MarkdownNode* paragraph = &item.children().front();
+
+    MarkdownNode moved(std::move(item));
+
+    REQUIRE(&moved.parent() == &ast);
+    REQUIRE(moved.children().size() == 2);
+
+    // The children are not reallocated, only pointed back to the new node
+    REQUIRE(&moved.children().front() == paragraph);
+    REQUIRE(&moved.children().front().parent() == &moved);
+    REQUIRE(&moved.children().back().parent() == &moved);
+}
+
+TEST_CASE("Move assigned node is the parent of its children", "[markdownnode]")
+{
+    MarkdownNode ast;
+    buildList(ast);
+
+    MarkdownNode root;
+    root = std::move(ast);
+
+    REQUIRE(root.children().size() == 1);
+    REQUIRE(&root.children().front().parent() == &root);
+
+    const MarkdownNode& item = root.children().front();
+    REQUIRE(&item.children().front().parent() == &item);
+}
+
+TEST_CASE("Copied node is the parent of the copied children only", "[markdownnode]")
+{
+    MarkdownNode ast;
+    buildList(ast);
+
+    MarkdownNode copy(ast);
+
+    REQUIRE(copy.children().size() == 1);
+    REQUIRE(&copy.children().front().parent() == &copy);
+    REQUIRE(&ast.children().front().parent() == &ast);
+
+    MarkdownNode assigned;
+    assigned = ast;
+
+    REQUIRE(&assigned.children().front().parent() == &assigned);
+    REQUIRE(&ast.children().front().parent() == &ast);
+}
+
+TEST_CASE("Childless node copies and moves without children", "[markdownnode]")
+{
+    const MarkdownNode leaf(ParagraphMarkdownNodeType, NULL, "text");
+
+    REQUIRE(leaf.children().empty());
+
+    MarkdownNode copy(leaf);
+    REQUIRE(copy.children().empty());
+    REQUIRE(copy.text == "text");
+
+    MarkdownNode moved(std::move(copy));
+    REQUIRE(moved.children().empty());
+    REQUIRE(!moved.hasParent());
+}
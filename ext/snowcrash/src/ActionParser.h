@@ -131,10 +131,16 @@ namespace snowcrash
 
                     checkPayload(sectionType, sourceMap, payload.node, out);
 
-                    out.node.examples.back().requests.push_back(payload.node);
+                    bool pending = payload.node.reference.meta.state == Reference::StatePending;
+                    out.node.examples.back().requests.push_back(std::move(payload.node));
+
+                    if (pending) {
+                        recordPendingReference(pd, out.node, true);
+                    }
 
                     if (pd.exportSourceMap()) {
-                        out.sourceMap.examples.collection.back().requests.collection.push_back(payload.sourceMap);
+                        out.sourceMap.examples.collection.back().requests.collection.push_back(
+                            std::move(payload.sourceMap));
                     }
 
                     break;
@@ -159,10 +165,16 @@ namespace snowcrash
 
                     checkPayload(sectionType, sourceMap, payload.node, out);
 
-                    out.node.examples.back().responses.push_back(payload.node);
+                    bool pending = payload.node.reference.meta.state == Reference::StatePending;
+                    out.node.examples.back().responses.push_back(std::move(payload.node));
+
+                    if (pending) {
+                        recordPendingReference(pd, out.node, false);
+                    }
 
                     if (pd.exportSourceMap()) {
-                        out.sourceMap.examples.collection.back().responses.collection.push_back(payload.sourceMap);
+                        out.sourceMap.examples.collection.back().responses.collection.push_back(
+                            std::move(payload.sourceMap));
                     }
 
                     break;
@@ -513,18 +525,46 @@ namespace snowcrash
             return;
         }
 
-        /** Finds an action inside an actions collection */
-        static ActionIterator findAction(const Actions& actions, const Action& action)
+        /** \returns Key identifying an action within its resource */
+        static std::string actionKey(const Action& action)
         {
+            // HTTP method never contains a space
+            return action.method + " " + action.uriTemplate;
+        }
 
-            return std::find_if(actions.begin(), actions.end(), std::bind2nd(MatchAction(), action));
+        /** Checks whether an action with the same method and URI template was parsed in the current resource */
+        static bool isActionDuplicate(const SectionParserData& pd, const Action& action)
+        {
+            return pd.resourceActions.find(actionKey(action)) != pd.resourceActions.end();
         }
 
-        /** Finds a relation identifier inside an actions collection */
-        static ActionIterator findRelation(const Actions& actions, const Relation& relation)
+        /** Checks whether a relation identifier was already used in the current resource */
+        static bool isRelationDuplicate(const SectionParserData& pd, const Relation& relation)
         {
+            return !relation.str.empty() && pd.resourceRelations.find(relation.str) != pd.resourceRelations.end();
+        }
+
+        /** Adds an action to the current resource indexes */
+        static void indexAction(SectionParserData& pd, const Action& action)
+        {
+            pd.resourceActions.insert(actionKey(action));
+
+            if (!action.relation.str.empty()) {
+                pd.resourceRelations.insert(action.relation.str);
+            }
+        }
+
+        /** Records the location of the payload just added to the last example, its model reference is pending */
+        static void recordPendingReference(SectionParserData& pd, const Action& action, bool request)
+        {
+            const TransactionExample& example = action.examples.back();
+
+            PendingReferenceLocation location = {};
+            location.example = action.examples.size() - 1;
+            location.payload = request ? example.requests.size() - 1 : example.responses.size() - 1;
+            location.request = request;
 
-            return std::find_if(actions.begin(), actions.end(), std::bind2nd(MatchRelation(), relation));
+            pd.pendingReferenceLocations.push_back(location);
         }
 
         static void checkForTypoMistake(const MarkdownNodeIterator& node, SectionParserData& pd, Report& report)
@@ -19,41 +19,71 @@ DataStructure& DataStructure::operator=(const mson::NamedType& rhs)
     return *this;
 }
 
+DataStructure& DataStructure::operator=(mson::NamedType&& rhs) noexcept
+{
+    this->name = std::move(rhs.name);
+    this->typeDefinition = std::move(rhs.typeDefinition);
+    this->sections = std::move(rhs.sections);
+
+    return *this;
+}
+
 Elements& Element::Content::elements()
 {
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        m_elements.reset(::new Elements);
 
     return *m_elements;
 }
 
 const Elements& Element::Content::elements() const
 {
+    static const Elements none;
+
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        return none;
 
     return *m_elements;
 }
 
-Element::Content::Content()
-{
-    m_elements.reset(::new Elements);
-}
+Element::Content::Content() {}
 
 Element::Content::Content(const Element::Content& rhs)
 {
     this->copy = rhs.copy;
     this->resource = rhs.resource;
     this->dataStructure = rhs.dataStructure;
-    m_elements.reset(::new Elements(*rhs.m_elements.get()));
+    if (rhs.m_elements.get())
+        m_elements.reset(::new Elements(*rhs.m_elements.get()));
+}
+
+Element::Content::Content(Element::Content&& rhs) noexcept
+    : copy(std::move(rhs.copy)),
+      resource(std::move(rhs.resource)),
+      dataStructure(std::move(rhs.dataStructure)),
+      m_elements(std::move(rhs.m_elements))
+{
 }
 
 Element::Content& Element::Content::operator=(const Element::Content& rhs)
 {
+    if (this == &rhs)
+        return *this;
+
     this->copy = rhs.copy;
     this->resource = rhs.resource;
     this->dataStructure = rhs.dataStructure;
-    m_elements.reset(::new Elements(*rhs.m_elements.get()));
+    m_elements.reset(rhs.m_elements.get() ? ::new Elements(*rhs.m_elements.get()) : NULL);
+
+    return *this;
+}
+
+Element::Content& Element::Content::operator=(Element::Content&& rhs) noexcept
+{
+    this->copy = std::move(rhs.copy);
+    this->resource = std::move(rhs.resource);
+    this->dataStructure = std::move(rhs.dataStructure);
+    m_elements = std::move(rhs.m_elements);
 
     return *this;
 }
@@ -70,6 +100,14 @@ Element::Element(const Element& rhs)
     this->category = rhs.category;
 }
 
+Element::Element(Element&& rhs) noexcept
+    : element(rhs.element),
+      attributes(std::move(rhs.attributes)),
+      content(std::move(rhs.content)),
+      category(rhs.category)
+{
+}
+
 Element& Element::operator=(const Element& rhs)
 {
     this->element = rhs.element;
@@ -80,4 +118,14 @@ Element& Element::operator=(const Element& rhs)
     return *this;
 }
 
+Element& Element::operator=(Element&& rhs) noexcept
+{
+    this->element = rhs.element;
+    this->attributes = std::move(rhs.attributes);
+    this->content = std::move(rhs.content);
+    this->category = rhs.category;
+
+    return *this;
+}
+
 Element::~Element() {}
@@ -191,6 +191,9 @@ namespace snowcrash
 
         /** Assignment operator for Named Type */
         DataStructure& operator=(const mson::NamedType& rhs);
+
+        /** Move assignment operator for Named Type */
+        DataStructure& operator=(mson::NamedType&& rhs) noexcept;
     };
 
     /**
@@ -418,9 +421,15 @@ namespace snowcrash
             /** Copy constructor */
             Content(const Element::Content& rhs);
 
+            /** Move constructor */
+            Content(Element::Content&& rhs) noexcept;
+
             /** Assignment operator */
             Content& operator=(const Element::Content& rhs);
 
+            /** Move assignment operator */
+            Content& operator=(Element::Content&& rhs) noexcept;
+
             /** Destructor */
             ~Content();
 
@@ -454,9 +463,15 @@ namespace snowcrash
         /** Copy constructor */
         Element(const Element& rhs);
 
+        /** Move constructor */
+        Element(Element&& rhs) noexcept;
+
         /** Assignment operator */
         Element& operator=(const Element& rhs);
 
+        /** Move assignment operator */
+        Element& operator=(Element&& rhs) noexcept;
+
         /** Destructor */
         ~Element();
     };
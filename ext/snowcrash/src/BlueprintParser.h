@@ -11,12 +11,18 @@
 
 #include <iterator>
 #include <algorithm>
+#include <exception>
+#include <memory>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
 #include "ResourceParser.h"
 #include "ResourceGroupParser.h"
 #include "DataStructureGroupParser.h"
 #include "SectionParser.h"
 #include "RegexMatch.h"
 #include "CodeBlockUtility.h"
+#include "DependencyGraph.h"
 
 namespace snowcrash
 {
@@ -99,14 +105,19 @@ namespace snowcrash
             const ParseResultRef<Blueprint>& out)
         {
 
+            if (pd.options & ParallelParseOption) {
+                return processNestedSectionsConcurrently(node, siblings, pd, out);
+            }
+
             MarkdownNodeIterator cur = node;
+            size_t firstPending = pd.pendingReferenceLocations.size();
 
             if (pd.sectionContext() == ResourceGroupSectionType) {
 
                 IntermediateParseResult<ResourceGroup> resourceGroup(out.report);
                 cur = ResourceGroupParser::parse(node, siblings, pd, resourceGroup);
 
-                if (isResourceGroupDuplicate(out.node, resourceGroup.node.attributes.name)) {
+                if (isResourceGroupDuplicate(pd, resourceGroup.node.attributes.name)) {
 
                     // WARN: duplicate resource group
                     std::stringstream ss;
@@ -124,23 +135,30 @@ namespace snowcrash
                     out.report.warnings.push_back(Warning(ss.str(), DuplicateWarning, sourceMap));
                 }
 
-                out.node.content.elements().push_back(resourceGroup.node);
+                indexElement(resourceGroup.node, pd);
+                out.node.content.elements().push_back(std::move(resourceGroup.node));
+                pd.locatePendingReferences(
+                    firstPending, &PendingReferenceLocation::element, out.node.content.elements().size() - 1);
 
                 if (pd.exportSourceMap()) {
-                    out.sourceMap.content.elements().collection.push_back(resourceGroup.sourceMap);
+                    out.sourceMap.content.elements().collection.push_back(std::move(resourceGroup.sourceMap));
                 }
             } else if (pd.sectionContext() == ResourceSectionType) {
 
                 IntermediateParseResult<ResourceGroup> resourceGroup(out.report);
                 cur = ResourceGroupParser::parse(node, siblings, pd, resourceGroup);
 
-                for (auto it : resourceGroup.node.content.elements()) {
-                    out.node.content.elements().push_back(it);
+                // The resources of the implicit group become elements of the blueprint
+                locateFlattenedReferences(firstPending, out.node.content.elements().size(), pd);
+
+                for (auto& it : resourceGroup.node.content.elements()) {
+                    indexElement(it, pd);
+                    out.node.content.elements().push_back(std::move(it));
                 }
 
                 if (pd.exportSourceMap()) {
-                    for (auto it : resourceGroup.sourceMap.content.elements().collection) {
-                        out.sourceMap.content.elements().collection.push_back(it);
+                    for (auto& it : resourceGroup.sourceMap.content.elements().collection) {
+                        out.sourceMap.content.elements().collection.push_back(std::move(it));
                     }
                 }
             } else if (pd.sectionContext() == DataStructureGroupSectionType) {
@@ -148,16 +166,303 @@ namespace snowcrash
                 IntermediateParseResult<DataStructureGroup> dataStructureGroup(out.report);
                 cur = DataStructureGroupParser::parse(node, siblings, pd, dataStructureGroup);
 
-                out.node.content.elements().push_back(dataStructureGroup.node);
+                indexElement(dataStructureGroup.node, pd);
+                out.node.content.elements().push_back(std::move(dataStructureGroup.node));
 
                 if (pd.exportSourceMap()) {
-                    out.sourceMap.content.elements().collection.push_back(dataStructureGroup.sourceMap);
+                    out.sourceMap.content.elements().collection.push_back(std::move(dataStructureGroup.sourceMap));
+                }
+            }
+
+            return cur;
+        }
+
+        /** Contiguous part of the nested sections parsed concurrently with the other shards */
+        struct NestedSectionShard {
+
+            NestedSectionShard(const SectionParserData& parent, const MarkdownNodeIterator& begin_)
+                : begin(begin_), end(begin_), cur(begin_), pd(parent, result.node)
+            {
+            }
+
+            MarkdownNodeIterator begin;
+            MarkdownNodes::const_iterator end;
+
+            /** Node the parsing of the shard stopped at */
+            MarkdownNodeIterator cur;
+
+            ParseResult<Blueprint> result;
+            SectionParserData pd;
+
+            std::exception_ptr exception;
+        };
+
+        typedef std::vector<std::unique_ptr<NestedSectionShard> > NestedSectionShards;
+
+        typedef SectionParser<Blueprint, BlueprintSectionAdapter> NestedSectionParser;
+
+        /**
+         *  \brief  Parse all the remaining nested sections, splitting them into shards parsed concurrently
+         *  \return Iterator to the first unparsed block
+         */
+        static MarkdownNodeIterator processNestedSectionsConcurrently(const MarkdownNodeIterator& node,
+            const MarkdownNodes& siblings,
+            SectionParserData& pd,
+            const ParseResultRef<Blueprint>& out)
+        {
+
+            NestedSectionShards shards = splitNestedSections(node, siblings, pd);
+
+            return parseShards(shards, siblings, pd, out);
+        }
+
+        /**
+         *  \brief  Parse the shards concurrently and merge them in document order
+         *
+         *  The result is the same as of parsing the nested sections sequentially. A shard that defines
+         *  a resource group, named type, resource or model already defined by the preceding shards,
+         *  refers to a model defined by them, adds a named type dependency reporting an error once added
+         *  after theirs or does not end exactly at its boundary is parsed again, sequentially. When the
+         *  sequential parsing goes past the beginning of the following shards, those are skipped and the
+         *  nodes up to the next shard are parsed sequentially as well.
+         *
+         *  \param  shards  Contiguous shards covering the nested sections up to the end of \p siblings
+         *  \return Iterator to the first unparsed block
+         */
+        static MarkdownNodeIterator parseShards(NestedSectionShards& shards,
+            const MarkdownNodes& siblings,
+            SectionParserData& pd,
+            const ParseResultRef<Blueprint>& out)
+        {
+
+            // Sections are parsed sequentially from now on, outside of the current section context
+            pd.options &= ~ParallelParseOption;
+            SectionParserData::SectionsStack sectionsContext;
+            sectionsContext.swap(pd.sectionsContext);
+
+            if (shards.size() > 1) {
+
+                std::vector<std::thread> workers;
+
+                for (auto it = shards.begin() + 1; it != shards.end(); ++it) {
+                    try {
+                        workers.emplace_back(parseShard, std::ref(**it), std::cref(siblings));
+                    } catch (const std::system_error&) {
+                        parseShard(**it, siblings);
+                    }
+                }
+
+                parseShard(*shards.front(), siblings);
+
+                for (auto& worker : workers) {
+                    worker.join();
                 }
             }
 
+            MarkdownNodeIterator cur = shards.front()->begin;
+
+            for (auto& shard : shards) {
+
+                if (cur < shard->begin) {
+                    cur = NestedSectionParser::parseNestedSections(cur, shard->begin, siblings, pd, out);
+                }
+
+                // Sequential parsing of a preceding shard went past the beginning of this one
+                if (cur != shard->begin) {
+                    continue;
+                }
+
+                if (shards.size() > 1 && !shard->exception && shard->cur == shard->end
+                    && !isShardConflicting(*shard, pd) && addDeferredDependencies(*shard, pd)) {
+
+                    mergeShard(*shard, pd, out);
+                    cur = shard->cur;
+                } else {
+                    cur = NestedSectionParser::parseNestedSections(shard->begin, shard->end, siblings, pd, out);
+                }
+            }
+
+            if (cur < siblings.end()) {
+                cur = NestedSectionParser::parseNestedSections(cur, siblings.end(), siblings, pd, out);
+            }
+
+            sectionsContext.swap(pd.sectionsContext);
+            pd.options |= ParallelParseOption;
+
             return cur;
         }
 
+        /**
+         *  \brief  Split the nested sections into shards at resource group and data structure group headers
+         *
+         *  There is at most one shard per hardware thread.
+         */
+        static NestedSectionShards splitNestedSections(
+            const MarkdownNodeIterator& node, const MarkdownNodes& siblings, const SectionParserData& pd)
+        {
+
+            NestedSectionShards shards;
+
+            size_t workers = std::max(std::thread::hardware_concurrency(), 1u);
+            size_t shardSize = (siblings.end() - node) / workers + 1;
+
+            shards.emplace_back(new NestedSectionShard(pd, node));
+
+            for (MarkdownNodeIterator cur = node; cur != siblings.end(); ++cur) {
+
+                if (cur - shards.back()->begin < static_cast<std::ptrdiff_t>(shardSize)
+                    || cur->type != mdp::HeaderMarkdownNodeType) {
+                    continue;
+                }
+
+                SectionType type = nestedSectionType(cur);
+
+                if (type == ResourceGroupSectionType || type == DataStructureGroupSectionType) {
+
+                    shards.back()->end = cur;
+                    shards.emplace_back(new NestedSectionShard(pd, cur));
+                }
+            }
+
+            shards.back()->end = siblings.end();
+
+            return shards;
+        }
+
+        /**
+         *  \brief  Parse nested sections of a shard
+         *
+         *  All the shards read the same markdown AST. Its nodes are only reached through
+         *  %MarkdownNodeIterator, a const iterator, so parsing never modifies them.
+         */
+        static void parseShard(NestedSectionShard& shard, const MarkdownNodes& siblings)
+        {
+
+            try {
+                shard.cur = NestedSectionParser::parseNestedSections(
+                    shard.begin, shard.end, siblings, shard.pd, ParseResultRef<Blueprint>(shard.result));
+            } catch (...) {
+                shard.exception = std::current_exception();
+            }
+        }
+
+        /** \returns True if any of the keys is in the table */
+        template <typename Table, typename Keys>
+        static bool containsAny(const Table& table, const Keys& keys)
+        {
+
+            for (const auto& key : keys) {
+                if (table.find(key) != table.end()) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /** \returns True if the shard depends on what is defined by the preceding shards */
+        static bool isShardConflicting(const NestedSectionShard& shard, const SectionParserData& pd)
+        {
+
+            if (containsAny(pd.resourceGroupNames, shard.pd.resourceGroupNames)
+                || containsAny(pd.resourceURITemplates, shard.pd.resourceURITemplates)
+                || containsAny(pd.modelTable, shard.pd.pendingModelReferences)) {
+
+                return true;
+            }
+
+            for (const auto& model : shard.pd.modelTable) {
+                if (pd.modelTable.find(model.first) != pd.modelTable.end()) {
+                    return true;
+                }
+            }
+
+            // Resources without attributes are indexed by an empty name
+            for (const auto& name : shard.pd.namedTypeNames) {
+                if (!name.empty() && pd.namedTypeNames.find(name) != pd.namedTypeNames.end()) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /**
+         *  \brief  Add the named type dependencies recorded by the shard, see %SectionParserData::isShard
+         *
+         *  Adding a dependency reports nothing but errors. When one does, the dependency table is left
+         *  as it was, the shard has to be parsed sequentially for the error to be reported in its place.
+         *
+         *  \return True if all the dependencies were added without an error
+         */
+        static bool addDeferredDependencies(const NestedSectionShard& shard, SectionParserData& pd)
+        {
+
+            if (shard.pd.deferredDependencies.empty()) {
+                return true;
+            }
+
+            mson::NamedTypeDependencyTable dependencies(pd.namedTypeDependencyTable);
+            Report report;
+
+            for (const auto& dependency : shard.pd.deferredDependencies) {
+
+                mson::addDependency(dependency.node,
+                    pd,
+                    dependency.dependency,
+                    dependency.dependent,
+                    report,
+                    dependency.circularCheck);
+
+                if (report.error.code != Error::OK) {
+                    pd.namedTypeDependencyTable.swap(dependencies);
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /** Append the parsed shard to the blueprint */
+        static void mergeShard(NestedSectionShard& shard, SectionParserData& pd, const ParseResultRef<Blueprint>& out)
+        {
+
+            size_t elementOffset = out.node.content.elements().size();
+
+            for (auto location : shard.pd.pendingReferenceLocations) {
+                location.element += elementOffset;
+                pd.pendingReferenceLocations.push_back(location);
+            }
+
+            for (auto& element : shard.result.node.content.elements()) {
+                indexElement(element, pd);
+                out.node.content.elements().push_back(std::move(element));
+            }
+
+            if (pd.exportSourceMap()) {
+                for (auto& element : shard.result.sourceMap.content.elements().collection) {
+                    out.sourceMap.content.elements().collection.push_back(std::move(element));
+                }
+            }
+
+            pd.resourceURITemplates.insert(shard.pd.resourceURITemplates.begin(), shard.pd.resourceURITemplates.end());
+            pd.pendingModelReferences.insert(
+                shard.pd.pendingModelReferences.begin(), shard.pd.pendingModelReferences.end());
+            pd.modelTable.insert(shard.pd.modelTable.begin(), shard.pd.modelTable.end());
+            pd.modelSourceMapTable.insert(shard.pd.modelSourceMapTable.begin(), shard.pd.modelSourceMapTable.end());
+
+            Report& report = shard.result.report;
+
+            out.report.warnings.insert(out.report.warnings.end(),
+                std::make_move_iterator(report.warnings.begin()),
+                std::make_move_iterator(report.warnings.end()));
+
+            // As when parsed sequentially, the last error reported is kept
+            if (report.error.code != Error::OK) {
+                out.report.error = std::move(report.error);
+            }
+        }
+
         /**
          * Look ahead through all the nested sections and gather list of all
          * named types along with their base types and the types they are sub-typed from
@@ -168,6 +473,29 @@ namespace snowcrash
             const ParseResultRef<Blueprint>& out)
         {
 
+            // Named types of a source parsed in parts are gathered from all the parts in advance
+            if (pd.namedTypesGathered) {
+                scanNestedSections(node, siblings, pd, out.report, false);
+                return;
+            }
+
+            scanNestedSections(node, siblings, pd, out.report, true);
+
+            // Resolve all named type base table entries
+            resolveNamedTypeTables(pd, out.report);
+        }
+
+        /**
+         * Check the nested sections for possible mistakes, filling the named type tables
+         * without resolving them if requested, see %preprocessNestedSections
+         */
+        static void scanNestedSections(const MarkdownNodeIterator& node,
+            const MarkdownNodes& siblings,
+            SectionParserData& pd,
+            Report& report,
+            bool fillNamedTypes)
+        {
+
             MarkdownNodeIterator cur = node, contextCur;
             SectionType sectionType = UndefinedSectionType;
             SectionType contextSectionType = UndefinedSectionType;
@@ -202,7 +530,7 @@ namespace snowcrash
                     }
 
                     // If context is DataStructures section, NamedTypes should be filled
-                    if (contextSectionType == DataStructureGroupSectionType) {
+                    if (fillNamedTypes && contextSectionType == DataStructureGroupSectionType) {
 
                         if (sectionType != MSONSampleDefaultSectionType && sectionType != MSONPropertyMembersSectionType
                             && sectionType != MSONValueMembersSectionType && sectionType != UndefinedSectionType
@@ -210,29 +538,26 @@ namespace snowcrash
 
                             contextSectionType = UndefinedSectionType;
                         } else if (sectionType == UndefinedSectionType) {
-                            fillNamedTypeTables(cur, pd, cur->text, out.report);
+                            fillNamedTypeTables(cur, pd, cur->text, report);
                         }
                     }
-                } else if (cur->type == mdp::ListItemMarkdownNodeType && contextSectionType == ResourceSectionType
-                    && sectionType == AttributesSectionType) {
+                } else if (fillNamedTypes && cur->type == mdp::ListItemMarkdownNodeType
+                    && contextSectionType == ResourceSectionType && sectionType == AttributesSectionType) {
 
                     Resource resource;
                     SectionProcessor<Resource>::matchNamedResourceHeader(contextCur, resource);
 
                     if (!resource.name.empty()) {
-                        fillNamedTypeTables(cur, pd, cur->children().front().text, out.report, resource.name);
+                        fillNamedTypeTables(cur, pd, cur->children().front().text, report, resource.name);
                     }
                 }
 
                 if (sectionType == UndefinedSectionType) {
-                    checkForPossibleSectionMistakes(cur, pd, out.report);
+                    checkForPossibleSectionMistakes(cur, pd, report);
                 }
 
                 cur++;
             }
-
-            // Resolve all named type base table entries
-            resolveNamedTypeTables(pd, out.report);
         }
 
         static void checkForPossibleSectionMistakes(
@@ -281,7 +606,11 @@ namespace snowcrash
             const MarkdownNodeIterator& node, SectionParserData& pd, const ParseResultRef<Blueprint>& out)
         {
 
-            checkLazyReferencing(pd, out);
+            {
+                ScopedTimer timer(pd.statistics ? &pd.statistics->lazyReferencesTime : nullptr);
+                checkLazyReferencing(pd, out);
+            }
+
             out.node.element = Element::CategoryElement;
 
             if (pd.exportSourceMap()) {
@@ -369,7 +698,7 @@ namespace snowcrash
             mson::BaseTypeName baseTypeName = typeDefinition.typeSpecification.name.base;
 
             // Initialize an entry in the dependency table
-            pd.namedTypeDependencyTable[identifier] = std::set<mson::Literal>();
+            pd.namedTypeDependencyTable[identifier] = mson::NamedTypeDependencies();
 
             // Add the respective entries to the tables
             if (baseTypeName != mson::UndefinedTypeName) {
@@ -408,12 +737,22 @@ namespace snowcrash
         static void resolveNamedTypeTables(SectionParserData& pd, Report& report)
         {
             // First resolve dependency tables
-            for (const auto& dependency : pd.namedTypeDependencyTable) {
-                resolveNamedTypeDependencyTableEntry(pd, dependency.first, report);
-            }
+            resolveNamedTypeDependencyTable(pd);
+
+            // Resolve in the order of the names, so the same error is reported for any table layout
+            std::vector<const mson::NamedTypeInheritanceTable::value_type*> inheritance;
+            inheritance.reserve(pd.namedTypeInheritanceTable.size());
 
             for (const auto& base : pd.namedTypeInheritanceTable) {
-                resolveNamedTypeBaseTableEntry(pd, base.first, base.second.first, base.second.second, report);
+                inheritance.push_back(&base);
+            }
+
+            std::sort(inheritance.begin(), inheritance.end(), [](const auto* lhs, const auto* rhs) {
+                return lhs->first < rhs->first;
+            });
+
+            for (const auto* base : inheritance) {
+                resolveNamedTypeBaseTableEntry(pd, base->first, base->second.first, base->second.second, report);
 
                 if (report.error.code != Error::OK) {
                     return;
@@ -422,39 +761,50 @@ namespace snowcrash
         }
 
         /**
-         * \brief Resolve the inheritance dependencies of the current named type
+         * \brief Add all the transitive inheritance dependencies to every entry of the dependency table
          *        (Does not include mixin or member dependencies)
          *
+         * Every dependency gets an entry, even if it is not defined.
+         *
          * \param pd Section parser data
-         * \param identifier The named type whose dependents need to be resolved
-         * \param report Parse report
          */
-        static void resolveNamedTypeDependencyTableEntry(
-            SectionParserData& pd, const mson::Literal& identifier, Report& report)
+        static void resolveNamedTypeDependencyTable(SectionParserData& pd)
         {
+            std::unordered_map<mson::Literal, DependencyGraph::Id> ids;
+            std::vector<const mson::Literal*> names;
+            DependencyGraph graph;
+
+            auto id = [&](const mson::Literal& name) {
+                auto inserted = ids.emplace(name, names.size());
+
+                if (inserted.second) {
+                    names.push_back(&inserted.first->first);
+                    graph.add();
+                }
 
-            std::set<mson::Literal> diffDeps, finalDeps, initialDeps;
+                return inserted.first->second;
+            };
 
-            do {
-                initialDeps = pd.namedTypeDependencyTable[identifier];
-                diffDeps.clear();
+            for (const auto& entry : pd.namedTypeDependencyTable) {
 
-                for (std::set<mson::Literal>::iterator it = initialDeps.begin(); it != initialDeps.end(); it++) {
+                DependencyGraph::Id dependent = id(entry.first);
 
-                    std::set<mson::Literal> superTypeDeps = pd.namedTypeDependencyTable[*it];
-                    pd.namedTypeDependencyTable[identifier].insert(superTypeDeps.begin(), superTypeDeps.end());
+                for (const auto& dependency : entry.second) {
+                    graph.addDependency(dependent, id(dependency));
                 }
+            }
 
-                // Check if the list of dependents has grown
-                finalDeps = pd.namedTypeDependencyTable[identifier];
-                std::set_difference(finalDeps.begin(),
-                    finalDeps.end(),
-                    initialDeps.begin(),
-                    initialDeps.end(),
-                    std::inserter(diffDeps, diffDeps.end()));
+            graph.resolve();
 
-            } while (!diffDeps.empty());
-        };
+            for (DependencyGraph::Id type = 0; type < names.size(); ++type) {
+
+                mson::NamedTypeDependencies& deps = pd.namedTypeDependencyTable[*names[type]];
+
+                for (DependencyGraph::Id dependency : graph.transitiveDependencies(type)) {
+                    deps.insert(*names[dependency]);
+                }
+            }
+        }
 
         /**
          * \brief For each entry in the named type inheritance table, resolve the sub-type's base type recursively
@@ -480,7 +830,7 @@ namespace snowcrash
             }
 
             // Check for circular references
-            std::set<mson::Literal> deps = pd.namedTypeDependencyTable[subType];
+            const mson::NamedTypeDependencies& deps = pd.namedTypeDependencyTable[subType];
 
             if (deps.find(subType) != deps.end()) {
 
@@ -559,21 +909,20 @@ namespace snowcrash
             if (lines.size() == out.node.size()) {
 
                 // Check duplicates
-                std::vector<mdp::ByteBuffer> duplicateKeys;
+                std::unordered_map<mdp::ByteBuffer, size_t> keyCount;
 
                 for (MetadataCollectionIterator it = out.node.begin(); it != out.node.end(); ++it) {
+                    ++keyCount[it->first];
+                }
 
-                    MetadataCollectionIterator from = it;
-                    if (++from == out.node.end())
-                        break;
+                for (MetadataCollectionIterator it = out.node.begin(); it != out.node.end(); ++it) {
 
-                    MetadataCollectionIterator duplicate
-                        = std::find_if(from, out.node.end(), std::bind2nd(MatchFirsts<Metadata>(), *it));
+                    std::unordered_map<mdp::ByteBuffer, size_t>::iterator count = keyCount.find(it->first);
 
-                    if (duplicate != out.node.end()
-                        && std::find(duplicateKeys.begin(), duplicateKeys.end(), it->first) == duplicateKeys.end()) {
+                    if (count->second > 1) {
 
-                        duplicateKeys.push_back(it->first);
+                        // Warn only once per key
+                        count->second = 0;
 
                         // WARN: duplicate metadata definition
                         std::stringstream ss;
@@ -599,217 +948,111 @@ namespace snowcrash
         /**
          * \brief Check if a resource group already exists with the given name
          *
-         * \param blueprint The blueprint which is formed until now
+         * \param pd Section parser state holding the index of the blueprint formed until now
          * \param name The resource group name to be checked
          */
-        static bool isResourceGroupDuplicate(const Blueprint& blueprint, mdp::ByteBuffer& name)
+        static bool isResourceGroupDuplicate(const SectionParserData& pd, const mdp::ByteBuffer& name)
         {
-
-            for (const auto& element : blueprint.content.elements()) {
-                if (element.element == Element::CategoryElement && element.category == Element::ResourceGroupCategory
-                    && element.attributes.name == name) {
-
-                    return true;
-                }
-            }
-
-            return false;
+            return pd.resourceGroupNames.find(name) != pd.resourceGroupNames.end();
         }
 
         /**
-         *  \brief  Checks both blueprint and source map AST to resolve references with `Pending` state (Lazy
-         * referencing)
-         *  \param  pd       Section parser state
-         *  \param  out      Processed output
+         * \brief Add an element about to be appended to the blueprint to the duplicate detection indexes
+         *
+         * \param element The element being added to the blueprint
+         * \param pd Section parser state
          */
-        static void checkLazyReferencing(SectionParserData& pd, const ParseResultRef<Blueprint>& out)
+        static void indexElement(const Element& element, SectionParserData& pd)
         {
 
-            Collection<SourceMap<Element> >::iterator elementSourceMapIt;
-
-            if (pd.exportSourceMap()) {
-                elementSourceMapIt = out.sourceMap.content.elements().collection.begin();
+            if (element.element == Element::ResourceElement) {
+                pd.namedTypeNames.insert(element.content.resource.attributes.name.symbol.literal);
             }
 
-            for (Elements::iterator elementIt = out.node.content.elements().begin();
-                 elementIt != out.node.content.elements().end();
-                 ++elementIt) {
-
-                if (elementIt->element == Element::CategoryElement) {
-                    checkResourceLazyReferencing(*elementIt, elementSourceMapIt, pd, out);
-                } else if (elementIt->element == Element::ResourceElement) {
-                    if (pd.exportSourceMap()) {
-                        checkActionLazyReferencing(
-                            elementIt->content.resource, elementSourceMapIt->content.resource, pd, out);
-                    } else {
-                        SourceMap<Resource> tempSourceMap;
-                        checkActionLazyReferencing(elementIt->content.resource, tempSourceMap, pd, out);
-                    }
-                }
-
-                if (pd.exportSourceMap()) {
-                    elementSourceMapIt++;
-                }
+            if (element.element != Element::CategoryElement) {
+                return;
             }
-        }
 
-        /** Traverses Resource Collection to resolve references with `Pending` state (Lazy referencing) */
-        static void checkResourceLazyReferencing(Element& element,
-            Collection<SourceMap<Element> >::iterator& elementSourceMap,
-            SectionParserData& pd,
-            const ParseResultRef<Blueprint>& out)
-        {
-
-            Collection<SourceMap<Element> >::iterator resourceElementSourceMapIt;
-
-            if (pd.exportSourceMap()) {
-                resourceElementSourceMapIt = elementSourceMap->content.elements().collection.begin();
+            if (element.category == Element::ResourceGroupCategory) {
+                pd.resourceGroupNames.insert(element.attributes.name);
             }
 
-            for (auto& resourceElement : element.content.elements()) {
-                if (resourceElement.element == Element::ResourceElement) {
-                    if (pd.exportSourceMap()) {
-                        checkActionLazyReferencing(
-                            resourceElement.content.resource, resourceElementSourceMapIt->content.resource, pd, out);
-                    } else {
-                        SourceMap<Resource> tempSourceMap;
-                        checkActionLazyReferencing(resourceElement.content.resource, tempSourceMap, pd, out);
-                    }
-                }
-
-                if (pd.exportSourceMap()) {
-                    resourceElementSourceMapIt++;
+            for (const auto& subElement : element.content.elements()) {
+                if (subElement.element == Element::ResourceElement) {
+                    pd.namedTypeNames.insert(subElement.content.resource.attributes.name.symbol.literal);
+                } else if (subElement.element == Element::DataStructureElement) {
+                    pd.namedTypeNames.insert(subElement.content.dataStructure.name.symbol.literal);
                 }
             }
         }
 
-        /** Traverses Action Collection to resolve references with `Pending` state (Lazy referencing) */
-        static void checkActionLazyReferencing(Resource& resource,
-            SourceMap<Resource>& resourceSourceMap,
-            SectionParserData& pd,
-            const ParseResultRef<Blueprint>& out)
+        /** Sets the blueprint elements of the pending references recorded in resources of a flattened group */
+        static void locateFlattenedReferences(size_t first, size_t elementOffset, SectionParserData& pd)
         {
 
-            Collection<SourceMap<Action> >::iterator actionSourceMapIt;
+            for (size_t i = first; i < pd.pendingReferenceLocations.size(); ++i) {
 
-            if (pd.exportSourceMap()) {
-                actionSourceMapIt = resourceSourceMap.actions.collection.begin();
-            }
+                PendingReferenceLocation& location = pd.pendingReferenceLocations[i];
 
-            for (Actions::iterator actionIt = resource.actions.begin(); actionIt != resource.actions.end();
-                 ++actionIt) {
-
-                checkExampleLazyReferencing(*actionIt, actionSourceMapIt, pd, out);
-
-                if (pd.exportSourceMap()) {
-                    actionSourceMapIt++;
-                }
+                location.element = elementOffset + location.resource;
+                location.resource = PendingReferenceLocation::ElementIsResource;
             }
         }
 
-        /** Traverses Transaction Example Collection AST to resolve references with `Pending` state (Lazy referencing)
+        /**
+         *  \brief  Resolves the references with `Pending` state (Lazy referencing) at their recorded locations in both
+         * blueprint and source map AST
+         *  \param  pd       Section parser state
+         *  \param  out      Processed output
          */
-        static void checkExampleLazyReferencing(Action& action,
-            Collection<SourceMap<Action> >::iterator& actionSourceMapIt,
-            SectionParserData& pd,
-            const ParseResultRef<Blueprint>& out)
+        static void checkLazyReferencing(SectionParserData& pd, const ParseResultRef<Blueprint>& out)
         {
 
-            Collection<SourceMap<TransactionExample> >::iterator exampleSourceMapIt;
-
-            if (pd.exportSourceMap()) {
-                exampleSourceMapIt = actionSourceMapIt->examples.collection.begin();
-            }
+            for (const auto& location : pd.pendingReferenceLocations) {
 
-            for (TransactionExamples::iterator transactionExampleIt = action.examples.begin();
-                 transactionExampleIt != action.examples.end();
-                 ++transactionExampleIt) {
+                Element& element = out.node.content.elements()[location.element];
+                Resource& resource = location.resource == PendingReferenceLocation::ElementIsResource
+                    ? element.content.resource
+                    : element.content.elements()[location.resource].content.resource;
+                TransactionExample& example = resource.actions[location.action].examples[location.example];
+                Payload& payload
+                    = location.request ? example.requests[location.payload] : example.responses[location.payload];
 
-                checkRequestLazyReferencing(*transactionExampleIt, exampleSourceMapIt, pd, out);
-                checkResponseLazyReferencing(*transactionExampleIt, exampleSourceMapIt, pd, out);
-
-                if (pd.exportSourceMap()) {
-                    exampleSourceMapIt++;
+                if (payload.reference.meta.state != Reference::StatePending) {
+                    continue;
                 }
-            }
-        }
-
-        /** Traverses Request Collection to resolve references with `Pending` state (Lazy referencing) */
-        static void checkRequestLazyReferencing(TransactionExample& transactionExample,
-            Collection<SourceMap<TransactionExample> >::iterator& transactionExampleSourceMapIt,
-            SectionParserData& pd,
-            const ParseResultRef<Blueprint>& out)
-        {
 
-            Collection<SourceMap<Request> >::iterator requestSourceMapIt;
-
-            if (pd.exportSourceMap()) {
-                requestSourceMapIt = transactionExampleSourceMapIt->requests.collection.begin();
-            }
-
-            for (Requests::iterator requestIt = transactionExample.requests.begin();
-                 requestIt != transactionExample.requests.end();
-                 ++requestIt) {
-
-                if (!requestIt->reference.id.empty() && requestIt->reference.meta.state == Reference::StatePending) {
-
-                    if (pd.exportSourceMap()) {
-
-                        ParseResultRef<Payload> payload(out.report, *requestIt, *requestSourceMapIt);
-                        resolvePendingModels(pd, payload);
-                        SectionProcessor<Payload>::checkRequest(requestIt->reference.meta.node, pd, payload);
-                    } else {
-
-                        SourceMap<Payload> tempSourceMap;
-                        ParseResultRef<Payload> payload(out.report, *requestIt, tempSourceMap);
-                        resolvePendingModels(pd, payload);
-                        SectionProcessor<Payload>::checkRequest(requestIt->reference.meta.node, pd, payload);
-                    }
-                }
+                SourceMap<Payload> tempSourceMap;
+                SourceMap<Payload>* payloadSourceMap = &tempSourceMap;
 
                 if (pd.exportSourceMap()) {
-                    requestSourceMapIt++;
-                }
-            }
-        }
-
-        /** Traverses Response Collection to resolve references with `Pending` state (Lazy referencing) */
-        static void checkResponseLazyReferencing(TransactionExample& transactionExample,
-            Collection<SourceMap<TransactionExample> >::iterator& transactionExampleSourceMapIt,
-            SectionParserData& pd,
-            const ParseResultRef<Blueprint>& out)
-        {
-
-            Collection<SourceMap<Response> >::iterator responseSourceMapIt;
 
-            if (pd.exportSourceMap()) {
-                responseSourceMapIt = transactionExampleSourceMapIt->responses.collection.begin();
-            }
-
-            for (Responses::iterator responseIt = transactionExample.responses.begin();
-                 responseIt != transactionExample.responses.end();
-                 ++responseIt) {
-
-                if (!responseIt->reference.id.empty() && responseIt->reference.meta.state == Reference::StatePending) {
-
-                    if (pd.exportSourceMap()) {
-
-                        ParseResultRef<Payload> payload(out.report, *responseIt, *responseSourceMapIt);
-                        resolvePendingModels(pd, payload);
-                        SectionProcessor<Payload>::checkResponse(responseIt->reference.meta.node, pd, payload);
-                    } else {
-
-                        SourceMap<Payload> tempSourceMap;
-                        ParseResultRef<Payload> payload(out.report, *responseIt, tempSourceMap);
-                        resolvePendingModels(pd, payload);
-                        SectionProcessor<Payload>::checkResponse(responseIt->reference.meta.node, pd, payload);
-                    }
+                    SourceMap<Element>& elementSourceMap
+                        = out.sourceMap.content.elements().collection[location.element];
+                    SourceMap<Resource>& resourceSourceMap
+                        = location.resource == PendingReferenceLocation::ElementIsResource
+                        ? elementSourceMap.content.resource
+                        : elementSourceMap.content.elements().collection[location.resource].content.resource;
+                    SourceMap<TransactionExample>& exampleSourceMap
+                        = resourceSourceMap.actions.collection[location.action].examples.collection[location.example];
+
+                    payloadSourceMap = location.request ? &exampleSourceMap.requests.collection[location.payload]
+                                                        : &exampleSourceMap.responses.collection[location.payload];
                 }
 
-                if (pd.exportSourceMap()) {
-                    responseSourceMapIt++;
+                ParseResultRef<Payload> result(out.report, payload, *payloadSourceMap);
+                resolvePendingModels(pd, result);
+
+                if (location.request) {
+                    SectionProcessor<Payload>::checkRequest(payload.reference.meta.node, pd, result);
+                } else {
+                    SectionProcessor<Payload>::checkResponse(payload.reference.meta.node, pd, result);
                 }
             }
+
+            // All the pending references are either resolved or reported now
+            pd.pendingReferenceLocations.clear();
+            pd.pendingModelReferences.clear();
         }
 
         /**
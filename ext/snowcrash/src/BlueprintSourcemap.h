@@ -272,9 +272,15 @@ namespace snowcrash
             /** Copy constructor */
             Content(const SourceMap<Element>::Content& rhs);
 
+            /** Move constructor */
+            Content(SourceMap<Element>::Content&& rhs) noexcept;
+
             /** Assignment operator */
             SourceMap<Element>::Content& operator=(const SourceMap<Element>::Content& rhs);
 
+            /** Move assignment operator */
+            SourceMap<Element>::Content& operator=(SourceMap<Element>::Content&& rhs) noexcept;
+
             /** Destructor */
             ~Content();
 
@@ -300,9 +306,15 @@ namespace snowcrash
         /** Copy constructor */
         SourceMap(const SourceMap<Element>& rhs);
 
+        /** Move constructor */
+        SourceMap(SourceMap<Element>&& rhs) noexcept;
+
         /** Assignment operator */
         SourceMap<Element>& operator=(const SourceMap<Element>& rhs);
 
+        /** Move assignment operator */
+        SourceMap<Element>& operator=(SourceMap<Element>&& rhs) noexcept;
+
         /** Destructor */
         ~SourceMap();
     };
@@ -87,30 +87,6 @@ namespace snowcrash
             return leftContentType == rightContentType;
         }
     };
-
-    /** URI matching predicate. */
-    struct MatchResource : std::binary_function<Resource, Resource, bool> {
-        bool operator()(const first_argument_type& first, const second_argument_type& second) const
-        {
-            return first.uriTemplate == second.uriTemplate;
-        }
-    };
-
-    /**  Action matching predicate. */
-    struct MatchAction : std::binary_function<Action, Action, bool> {
-        bool operator()(const first_argument_type& first, const second_argument_type& second) const
-        {
-            return first.uriTemplate == second.uriTemplate && first.method == second.method;
-        }
-    };
-
-    /** Relation matching predicate. */
-    struct MatchRelation : std::binary_function<Action, Relation, bool> {
-        bool operator()(const first_argument_type& first, const second_argument_type& second) const
-        {
-            return !first.relation.str.empty() && !second.str.empty() && first.relation.str == second.str;
-        }
-    };
 }
 
 #endif
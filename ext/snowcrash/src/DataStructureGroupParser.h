@@ -40,7 +40,7 @@ namespace snowcrash
                 IntermediateParseResult<mson::NamedType> namedType(out.report);
                 cur = MSONNamedTypeParser::parse(node, siblings, pd, namedType);
 
-                if (isNamedTypeDuplicate(pd.blueprint, namedType.node.name.symbol.literal)) {
+                if (isNamedTypeDuplicate(pd, namedType.node.name.symbol.literal)) {
 
                     // WARN: duplicate named type
                     std::stringstream ss;
@@ -52,20 +52,18 @@ namespace snowcrash
                     return cur;
                 }
 
-                Element element(Element::DataStructureElement);
-                element.content.dataStructure = namedType.node;
-
-                out.node.content.elements().push_back(element);
+                out.node.content.elements().emplace_back(Element::DataStructureElement);
+                out.node.content.elements().back().content.dataStructure = std::move(namedType.node);
 
                 if (pd.exportSourceMap()) {
 
                     SourceMap<Element> elementSM(Element::DataStructureElement);
 
-                    elementSM.content.dataStructure.name = namedType.sourceMap.name;
-                    elementSM.content.dataStructure.typeDefinition = namedType.sourceMap.typeDefinition;
-                    elementSM.content.dataStructure.sections = namedType.sourceMap.sections;
+                    elementSM.content.dataStructure.name = std::move(namedType.sourceMap.name);
+                    elementSM.content.dataStructure.typeDefinition = std::move(namedType.sourceMap.typeDefinition);
+                    elementSM.content.dataStructure.sections = std::move(namedType.sourceMap.sections);
 
-                    out.sourceMap.content.elements().collection.push_back(elementSM);
+                    out.sourceMap.content.elements().collection.push_back(std::move(elementSM));
                 }
             }
 
@@ -118,44 +116,12 @@ namespace snowcrash
         /**
          * \brief Check if a named type already exists with the given name
          *
-         * \param blueprint The blueprint which is formed until now
+         * \param pd Section parser state holding the index of the blueprint formed until now
          * \param name The named type name to be checked
          */
-        static bool isNamedTypeDuplicate(const Blueprint& blueprint, mdp::ByteBuffer& name)
+        static bool isNamedTypeDuplicate(const SectionParserData& pd, const mdp::ByteBuffer& name)
         {
-
-            for (Elements::const_iterator it = blueprint.content.elements().begin();
-                 it != blueprint.content.elements().end();
-                 ++it) {
-
-                if (it->element == Element::ResourceElement
-                    && it->content.resource.attributes.name.symbol.literal == name) {
-
-                    return true;
-                }
-
-                if (it->element == Element::CategoryElement) {
-
-                    for (Elements::const_iterator subIt = it->content.elements().begin();
-                         subIt != it->content.elements().end();
-                         ++subIt) {
-
-                        if (subIt->element == Element::ResourceElement
-                            && subIt->content.resource.attributes.name.symbol.literal == name) {
-
-                            return true;
-                        }
-
-                        if (subIt->element == Element::DataStructureElement
-                            && subIt->content.dataStructure.name.symbol.literal == name) {
-
-                            return true;
-                        }
-                    }
-                }
-            }
-
-            return false;
+            return pd.namedTypeNames.find(name) != pd.namedTypeNames.end();
         }
     };
 
@@ -0,0 +1,227 @@
+//
+//  DependencyGraph.cc
+//  snowcrash
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#include <algorithm>
+#include <limits>
+#include "DependencyGraph.h"
+
+using namespace snowcrash;
+
+namespace
+{
+    const size_t WordBits = 64;
+    const size_t Unvisited = std::numeric_limits<size_t>::max();
+
+    /** Frame of the depth-first search, the item and its next dependency to visit */
+    struct SearchFrame {
+        DependencyGraph::Id item;
+        size_t next;
+    };
+}
+
+DependencyGraph::DependencyGraph(size_t size) : adjacency(size) {}
+
+size_t DependencyGraph::size() const
+{
+    return adjacency.size();
+}
+
+DependencyGraph::Id DependencyGraph::add()
+{
+    adjacency.push_back(Ids());
+    return adjacency.size() - 1;
+}
+
+void DependencyGraph::addDependency(Id item, Id dependency)
+{
+    Id last = std::max(item, dependency);
+
+    if (last >= adjacency.size())
+        adjacency.resize(last + 1);
+
+    adjacency[item].push_back(dependency);
+}
+
+const DependencyGraph::Ids& DependencyGraph::dependencies(Id item) const
+{
+    return adjacency[item];
+}
+
+void DependencyGraph::resolveComponents()
+{
+    const size_t itemCount = adjacency.size();
+
+    componentItems.clear();
+    componentOf.assign(itemCount, Unvisited);
+    cyclicComponents.clear();
+    closure.clear();
+
+    std::vector<size_t> index(itemCount, Unvisited);
+    std::vector<size_t> lowLink(itemCount, 0);
+    std::vector<bool> onStack(itemCount, false);
+    Ids stack;
+    std::vector<SearchFrame> frames;
+    size_t counter = 0;
+
+    auto visit = [&](Id item) {
+        index[item] = lowLink[item] = counter++;
+        stack.push_back(item);
+        onStack[item] = true;
+        frames.push_back({ item, 0 });
+    };
+
+    for (Id root = 0; root < itemCount; ++root) {
+
+        if (index[root] != Unvisited)
+            continue;
+
+        visit(root);
+
+        while (!frames.empty()) {
+
+            Id item = frames.back().item;
+
+            if (frames.back().next < adjacency[item].size()) {
+
+                Id dependency = adjacency[item][frames.back().next++];
+
+                if (index[dependency] == Unvisited) {
+                    visit(dependency);
+                } else if (onStack[dependency]) {
+                    lowLink[item] = std::min(lowLink[item], index[dependency]);
+                }
+
+                continue;
+            }
+
+            frames.pop_back();
+
+            if (!frames.empty()) {
+                Id parent = frames.back().item;
+                lowLink[parent] = std::min(lowLink[parent], lowLink[item]);
+            }
+
+            if (lowLink[item] != index[item])
+                continue;
+
+            // The item is the root of a component, all its dependencies are in preceding components
+            size_t component = componentItems.size();
+            componentItems.push_back(Ids());
+
+            Id member;
+
+            do {
+                member = stack.back();
+                stack.pop_back();
+                onStack[member] = false;
+
+                componentOf[member] = component;
+                componentItems.back().push_back(member);
+            } while (member != item);
+
+            std::sort(componentItems.back().begin(), componentItems.back().end());
+        }
+    }
+
+    // A component is cyclic if it has more than one item or an item depends on itself
+    cyclicComponents.resize(componentItems.size());
+
+    for (size_t component = 0; component < componentItems.size(); ++component) {
+
+        bool cyclic = componentItems[component].size() > 1;
+
+        for (Id member : componentItems[component]) {
+            cyclic = cyclic
+                || std::find(adjacency[member].begin(), adjacency[member].end(), member) != adjacency[member].end();
+        }
+
+        cyclicComponents[component] = cyclic;
+    }
+}
+
+void DependencyGraph::resolve()
+{
+    resolveComponents();
+
+    const size_t itemCount = adjacency.size();
+
+    // Closure of the components in reverse topological order
+    const size_t words = (itemCount + WordBits - 1) / WordBits;
+    closure.resize(componentItems.size());
+
+    for (size_t component = 0; component < componentItems.size(); ++component) {
+
+        Bitset& reachable = closure[component];
+        reachable.assign(words, 0);
+
+        for (Id member : componentItems[component]) {
+            for (Id dependency : adjacency[member]) {
+
+                size_t dependencyComponent = componentOf[dependency];
+
+                if (dependencyComponent == component)
+                    continue;
+
+                const Bitset& dependencyReachable = closure[dependencyComponent];
+
+                for (size_t word = 0; word < words; ++word) {
+                    reachable[word] |= dependencyReachable[word];
+                }
+
+                reachable[dependency / WordBits] |= Word(1) << (dependency % WordBits);
+            }
+        }
+
+        if (cyclicComponents[component]) {
+            for (Id member : componentItems[component]) {
+                reachable[member / WordBits] |= Word(1) << (member % WordBits);
+            }
+        }
+    }
+}
+
+const std::vector<DependencyGraph::Ids>& DependencyGraph::components() const
+{
+    return componentItems;
+}
+
+size_t DependencyGraph::component(Id item) const
+{
+    return componentOf[item];
+}
+
+bool DependencyGraph::isCyclic(Id item) const
+{
+    return cyclicComponents[componentOf[item]];
+}
+
+bool DependencyGraph::dependsOn(Id item, Id dependency) const
+{
+    const Bitset& reachable = closure[componentOf[item]];
+    return (reachable[dependency / WordBits] >> (dependency % WordBits)) & 1;
+}
+
+DependencyGraph::Ids DependencyGraph::transitiveDependencies(Id item) const
+{
+    const Bitset& reachable = closure[componentOf[item]];
+    Ids result;
+
+    for (size_t word = 0; word < reachable.size(); ++word) {
+        for (Word bits = reachable[word]; bits; bits &= bits - 1) {
+
+            size_t bit = 0;
+
+            while (!((bits >> bit) & 1)) {
+                ++bit;
+            }
+
+            result.push_back(word * WordBits + bit);
+        }
+    }
+
+    return result;
+}
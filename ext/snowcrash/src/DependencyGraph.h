@@ -0,0 +1,87 @@
+//
+//  DependencyGraph.h
+//  snowcrash
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_DEPENDENCYGRAPH_H
+#define SNOWCRASH_DEPENDENCYGRAPH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace snowcrash
+{
+
+    /**
+     *  \brief Graph of dependencies between items identified by consecutive integers
+     *
+     *  Once all the dependencies are added, %resolve() finds the strongly connected
+     *  components (Tarjan's algorithm) and the transitive closure of the dependencies.
+     *  The closure is computed on the components in reverse topological order and kept
+     *  as a bitset of the items for every component.
+     *
+     *  The closure takes quadratic space; %resolveComponents() finds the components
+     *  only, which is enough for ordering the items and finding the cycles.
+     */
+    class DependencyGraph
+    {
+    public:
+        typedef size_t Id;
+        typedef std::vector<Id> Ids;
+
+        explicit DependencyGraph(size_t size = 0);
+
+        /** \returns Number of items */
+        size_t size() const;
+
+        /** Add an item, \returns Its identifier */
+        Id add();
+
+        /** Make the item depend on the dependency, adding any missing items */
+        void addDependency(Id item, Id dependency);
+
+        /** \returns Direct dependencies of the item */
+        const Ids& dependencies(Id item) const;
+
+        /** Find the components and the transitive closure of the dependencies */
+        void resolve();
+
+        /** Find the components only, %dependsOn() and %transitiveDependencies() need %resolve() */
+        void resolveComponents();
+
+        /**
+         *  \returns Strongly connected components
+         *
+         *  A component comes after all the components it depends on.
+         */
+        const std::vector<Ids>& components() const;
+
+        /** \returns Component of the item */
+        size_t component(Id item) const;
+
+        /** \returns True if the item depends on itself, directly or transitively */
+        bool isCyclic(Id item) const;
+
+        /** \returns True if the item depends on the dependency, directly or transitively */
+        bool dependsOn(Id item, Id dependency) const;
+
+        /** \returns All the dependencies of the item, direct and transitive, in increasing order */
+        Ids transitiveDependencies(Id item) const;
+
+    private:
+        typedef uint64_t Word;
+        typedef std::vector<Word> Bitset;
+
+        std::vector<Ids> adjacency;
+
+        std::vector<Ids> componentItems;
+        std::vector<size_t> componentOf;
+        std::vector<bool> cyclicComponents;
+        std::vector<Bitset> closure;
+    };
+}
+
+#endif
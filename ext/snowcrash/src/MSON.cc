@@ -43,15 +43,17 @@ bool ValueDefinition::empty() const
 Elements& TypeSection::Content::elements()
 {
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        m_elements.reset(::new Elements);
 
     return *m_elements;
 }
 
 const Elements& TypeSection::Content::elements() const
 {
+    static const Elements none;
+
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        return none;
 
     return *m_elements;
 }
@@ -59,21 +61,38 @@ const Elements& TypeSection::Content::elements() const
 TypeSection::Content::Content(const Markdown& description_, const Literal& value_)
     : description(description_), value(value_)
 {
-    m_elements.reset(::new Elements);
 }
 
 TypeSection::Content::Content(const TypeSection::Content& rhs)
 {
     this->description = rhs.description;
     this->value = rhs.value;
-    m_elements.reset(::new Elements(*rhs.m_elements.get()));
+    if (rhs.m_elements.get())
+        m_elements.reset(::new Elements(*rhs.m_elements.get()));
+}
+
+TypeSection::Content::Content(TypeSection::Content&& rhs) noexcept
+    : description(std::move(rhs.description)), value(std::move(rhs.value)), m_elements(std::move(rhs.m_elements))
+{
 }
 
 TypeSection::Content& TypeSection::Content::operator=(const TypeSection::Content& rhs)
 {
+    if (this == &rhs)
+        return *this;
+
     this->description = rhs.description;
     this->value = rhs.value;
-    m_elements.reset(::new Elements(*rhs.m_elements.get()));
+    m_elements.reset(rhs.m_elements.get() ? ::new Elements(*rhs.m_elements.get()) : NULL);
+
+    return *this;
+}
+
+TypeSection::Content& TypeSection::Content::operator=(TypeSection::Content&& rhs) noexcept
+{
+    this->description = std::move(rhs.description);
+    this->value = std::move(rhs.value);
+    m_elements = std::move(rhs.m_elements);
 
     return *this;
 }
@@ -109,15 +128,17 @@ bool PropertyMember::empty() const
 OneOf& Element::Content::oneOf()
 {
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        m_elements.reset(::new OneOf);
 
     return *m_elements;
 }
 
 const OneOf& Element::Content::oneOf() const
 {
+    static const OneOf none;
+
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        return none;
 
     return *m_elements;
 }
@@ -125,15 +146,17 @@ const OneOf& Element::Content::oneOf() const
 Elements& Element::Content::elements()
 {
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        m_elements.reset(::new Elements);
 
     return *m_elements;
 }
 
 const Elements& Element::Content::elements() const
 {
+    static const Elements none;
+
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        return none;
 
     return *m_elements;
 }
@@ -145,25 +168,51 @@ Element::Content& Element::Content::operator=(const Elements& rhs)
     return *this;
 }
 
-Element::Content::Content()
+Element::Content& Element::Content::operator=(Elements&& rhs)
 {
-    m_elements.reset(::new Elements);
+    m_elements.reset(::new Elements(std::move(rhs)));
+
+    return *this;
 }
 
+Element::Content::Content() {}
+
 Element::Content::Content(const Element::Content& rhs)
 {
     this->property = rhs.property;
     this->value = rhs.value;
     this->mixin = rhs.mixin;
-    m_elements.reset(::new Elements(*rhs.m_elements.get()));
+    if (rhs.m_elements.get())
+        m_elements.reset(::new Elements(*rhs.m_elements.get()));
+}
+
+Element::Content::Content(Element::Content&& rhs) noexcept
+    : property(std::move(rhs.property)),
+      value(std::move(rhs.value)),
+      mixin(std::move(rhs.mixin)),
+      m_elements(std::move(rhs.m_elements))
+{
 }
 
 Element::Content& Element::Content::operator=(const Element::Content& rhs)
 {
+    if (this == &rhs)
+        return *this;
+
     this->property = rhs.property;
     this->value = rhs.value;
     this->mixin = rhs.mixin;
-    m_elements.reset(::new Elements(*rhs.m_elements.get()));
+    m_elements.reset(rhs.m_elements.get() ? ::new Elements(*rhs.m_elements.get()) : NULL);
+
+    return *this;
+}
+
+Element::Content& Element::Content::operator=(Element::Content&& rhs) noexcept
+{
+    this->property = std::move(rhs.property);
+    this->value = std::move(rhs.value);
+    this->mixin = std::move(rhs.mixin);
+    m_elements = std::move(rhs.m_elements);
 
     return *this;
 }
@@ -178,6 +227,8 @@ Element::Element(const Element& rhs)
     this->content = rhs.content;
 }
 
+Element::Element(Element&& rhs) noexcept : klass(rhs.klass), content(std::move(rhs.content)) {}
+
 Element& Element::operator=(const Element& rhs)
 {
     this->klass = rhs.klass;
@@ -186,6 +237,14 @@ Element& Element::operator=(const Element& rhs)
     return *this;
 }
 
+Element& Element::operator=(Element&& rhs) noexcept
+{
+    this->klass = rhs.klass;
+    this->content = std::move(rhs.content);
+
+    return *this;
+}
+
 Element::~Element() {}
 
 /**
@@ -255,3 +314,58 @@ void Element::buildFromElements(const Elements& elements)
     this->klass = Element::GroupClass;
     this->content = elements;
 }
+
+/**
+ * \brief Build Element from property member, taking its content
+ *
+ * \param propertyMember Property member which was given
+ */
+void Element::build(PropertyMember&& propertyMember)
+{
+    this->klass = Element::PropertyClass;
+    this->content.property = std::move(propertyMember);
+}
+
+/**
+ * \brief Build Element from value member, taking its content
+ *
+ * \param valueMember Value member which was given
+ */
+void Element::build(ValueMember&& valueMember)
+{
+    this->klass = Element::ValueClass;
+    this->content.value = std::move(valueMember);
+}
+
+/**
+ * \brief Build Element from mixin type, taking its content
+ *
+ * \param mixin Mixin which was given
+ */
+void Element::build(Mixin&& mixin)
+{
+    this->klass = Element::MixinClass;
+    this->content.mixin = std::move(mixin);
+}
+
+/**
+ * \brief Build Element from one of type, taking its content
+ *
+ * \param oneOf One Of which was given
+ */
+void Element::build(OneOf&& oneOf)
+{
+    this->buildFromElements(std::move(oneOf));
+    this->klass = Element::OneOfClass;
+}
+
+/**
+ * \brief Build Element from group of elements, taking its content
+ *
+ * \param elements Group of elements
+ */
+void Element::buildFromElements(Elements&& elements)
+{
+    this->klass = Element::GroupClass;
+    this->content = std::move(elements);
+}
@@ -11,14 +11,13 @@
 
 #include <vector>
 #include <string>
-#include <set>
-#include <map>
+#include <unordered_map>
+#include <unordered_set>
 #include <stdexcept>
 
 #include "Platform.h"
 #include "MarkdownParser.h"
 
-#define ELEMENTS_NOT_SET_ERR std::logic_error("no elements set")
 
 /**
  * MSON Abstract Syntax Tree
@@ -54,13 +53,16 @@ namespace mson
     };
 
     /** Named Types base type table */
-    typedef std::map<Literal, BaseType> NamedTypeBaseTable;
+    typedef std::unordered_map<Literal, BaseType> NamedTypeBaseTable;
 
     /** Named Types inheritance table */
-    typedef std::map<Literal, std::pair<Literal, mdp::BytesRangeSet> > NamedTypeInheritanceTable;
+    typedef std::unordered_map<Literal, std::pair<Literal, mdp::BytesRangeSet> > NamedTypeInheritanceTable;
+
+    /** Named types a named type depends on */
+    typedef std::unordered_set<Literal> NamedTypeDependencies;
 
     /** Named Types dependency table */
-    typedef std::map<Literal, std::set<Literal> > NamedTypeDependencyTable;
+    typedef std::unordered_map<Literal, NamedTypeDependencies> NamedTypeDependencyTable;
 
     /** A simple or actual value */
     struct Value {
@@ -231,9 +233,15 @@ namespace mson
             /** Copy constructor */
             Content(const TypeSection::Content& rhs);
 
+            /** Move constructor */
+            Content(TypeSection::Content&& rhs) noexcept;
+
             /** Assignment operator */
             TypeSection::Content& operator=(const TypeSection::Content& rhs);
 
+            /** Move assignment operator */
+            TypeSection::Content& operator=(TypeSection::Content&& rhs) noexcept;
+
             /** Desctructor */
             ~Content();
 
@@ -360,6 +368,7 @@ namespace mson
 
             /** Builds the structure from group of elements */
             Element::Content& operator=(const Elements& rhs);
+            Element::Content& operator=(Elements&& rhs);
 
             /** Constructor */
             Content();
@@ -367,9 +376,15 @@ namespace mson
             /** Copy constructor */
             Content(const Element::Content& rhs);
 
+            /** Move constructor */
+            Content(Element::Content&& rhs) noexcept;
+
             /** Assignment operator */
             Content& operator=(const Element::Content& rhs);
 
+            /** Move assignment operator */
+            Content& operator=(Element::Content&& rhs) noexcept;
+
             /** Destructor */
             ~Content();
 
@@ -389,9 +404,15 @@ namespace mson
         /** Copy constructor */
         Element(const Element& rhs);
 
+        /** Move constructor */
+        Element(Element&& rhs) noexcept;
+
         /** Assignment operator */
         Element& operator=(const Element& rhs);
 
+        /** Move assignment operator */
+        Element& operator=(Element&& rhs) noexcept;
+
         /** Functions which allow the building of member type */
         void build(const PropertyMember& propertyMember);
         void build(const ValueMember& valueMember);
@@ -399,7 +420,13 @@ namespace mson
         void build(const OneOf& oneOf);
         void build(const Value& value);
 
+        void build(PropertyMember&& propertyMember);
+        void build(ValueMember&& valueMember);
+        void build(Mixin&& mixin);
+        void build(OneOf&& oneOf);
+
         void buildFromElements(const Elements& elements);
+        void buildFromElements(Elements&& elements);
 
         /** Destructor */
         ~Element();
@@ -29,10 +29,10 @@ namespace snowcrash
                 IntermediateParseResult<mson::Mixin> mixin(out.report);
                 cur = MSONMixinParser::parse(node, siblings, pd, mixin);
 
-                element.build(mixin.node);
+                element.build(std::move(mixin.node));
 
                 if (pd.exportSourceMap()) {
-                    elementSM.mixin = mixin.sourceMap;
+                    elementSM.mixin = std::move(mixin.sourceMap);
                 }
 
                 break;
@@ -42,10 +42,10 @@ namespace snowcrash
                 IntermediateParseResult<mson::OneOf> oneOf(out.report);
                 cur = MSONOneOfParser::parse(node, siblings, pd, oneOf);
 
-                element.build(oneOf.node);
+                element.build(std::move(oneOf.node));
 
                 if (pd.exportSourceMap()) {
-                    elementSM = oneOf.sourceMap;
+                    elementSM = std::move(oneOf.sourceMap);
                 }
 
                 break;
@@ -57,10 +57,10 @@ namespace snowcrash
 
                 cur = MSONTypeSectionListParser::parse(node, siblings, pd, typeSection);
 
-                element.buildFromElements(typeSection.node.content.elements());
+                element.buildFromElements(std::move(typeSection.node.content.elements()));
 
                 if (pd.exportSourceMap()) {
-                    elementSM = typeSection.sourceMap.elements();
+                    elementSM = std::move(typeSection.sourceMap.elements());
                 }
 
                 break;
@@ -70,10 +70,10 @@ namespace snowcrash
                 IntermediateParseResult<mson::PropertyMember> propertyMember(out.report);
                 cur = MSONPropertyMemberParser::parse(node, siblings, pd, propertyMember);
 
-                element.build(propertyMember.node);
+                element.build(std::move(propertyMember.node));
 
                 if (pd.exportSourceMap()) {
-                    elementSM.property = propertyMember.sourceMap;
+                    elementSM.property = std::move(propertyMember.sourceMap);
                 }
 
                 break;
@@ -84,10 +84,10 @@ namespace snowcrash
         }
 
         if (element.klass != mson::Element::UndefinedClass) {
-            out.node.push_back(element);
+            out.node.push_back(std::move(element));
 
             if (pd.exportSourceMap()) {
-                out.sourceMap.collection.push_back(elementSM);
+                out.sourceMap.collection.push_back(std::move(elementSM));
             }
         }
 
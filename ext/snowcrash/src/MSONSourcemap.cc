@@ -29,15 +29,17 @@ bool SourceMap<mson::PropertyMember>::empty() const
 SourceMap<mson::Elements>& SourceMap<mson::TypeSection>::elements()
 {
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        m_elements.reset(::new SourceMap<mson::Elements>);
 
     return *m_elements;
 }
 
 const SourceMap<mson::Elements>& SourceMap<mson::TypeSection>::elements() const
 {
+    static const SourceMap<mson::Elements> none;
+
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        return none;
 
     return *m_elements;
 }
@@ -46,21 +48,38 @@ SourceMap<mson::TypeSection>::SourceMap(
     const SourceMap<mson::Markdown>& description_, const SourceMap<mson::Literal>& value_)
     : description(description_), value(value_)
 {
-    m_elements.reset(::new SourceMap<mson::Elements>);
 }
 
 SourceMap<mson::TypeSection>::SourceMap(const SourceMap<mson::TypeSection>& rhs)
 {
     this->description = rhs.description;
     this->value = rhs.value;
-    m_elements.reset(::new SourceMap<mson::Elements>(*rhs.m_elements.get()));
+    if (rhs.m_elements.get())
+        m_elements.reset(::new SourceMap<mson::Elements>(*rhs.m_elements.get()));
+}
+
+SourceMap<mson::TypeSection>::SourceMap(SourceMap<mson::TypeSection>&& rhs) noexcept
+    : description(std::move(rhs.description)), value(std::move(rhs.value)), m_elements(std::move(rhs.m_elements))
+{
 }
 
 SourceMap<mson::TypeSection>& SourceMap<mson::TypeSection>::operator=(const SourceMap<mson::TypeSection>& rhs)
 {
+    if (this == &rhs)
+        return *this;
+
     this->description = rhs.description;
     this->value = rhs.value;
-    m_elements.reset(::new SourceMap<mson::Elements>(*rhs.m_elements.get()));
+    m_elements.reset(rhs.m_elements.get() ? ::new SourceMap<mson::Elements>(*rhs.m_elements.get()) : NULL);
+
+    return *this;
+}
+
+SourceMap<mson::TypeSection>& SourceMap<mson::TypeSection>::operator=(SourceMap<mson::TypeSection>&& rhs) noexcept
+{
+    this->description = std::move(rhs.description);
+    this->value = std::move(rhs.value);
+    m_elements = std::move(rhs.m_elements);
 
     return *this;
 }
@@ -70,15 +89,17 @@ SourceMap<mson::TypeSection>::~SourceMap() {}
 SourceMap<mson::OneOf>& SourceMap<mson::Element>::oneOf()
 {
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        m_elements.reset(::new SourceMap<mson::OneOf>);
 
     return *m_elements;
 }
 
 const SourceMap<mson::OneOf>& SourceMap<mson::Element>::oneOf() const
 {
+    static const SourceMap<mson::OneOf> none;
+
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        return none;
 
     return *m_elements;
 }
@@ -86,15 +107,17 @@ const SourceMap<mson::OneOf>& SourceMap<mson::Element>::oneOf() const
 SourceMap<mson::Elements>& SourceMap<mson::Element>::elements()
 {
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        m_elements.reset(::new SourceMap<mson::Elements>);
 
     return *m_elements;
 }
 
 const SourceMap<mson::Elements>& SourceMap<mson::Element>::elements() const
 {
+    static const SourceMap<mson::Elements> none;
+
     if (!m_elements.get())
-        throw ELEMENTS_NOT_SET_ERR;
+        return none;
 
     return *m_elements;
 }
@@ -106,25 +129,51 @@ SourceMap<mson::Element>& SourceMap<mson::Element>::operator=(const SourceMap<ms
     return *this;
 }
 
-SourceMap<mson::Element>::SourceMap()
+SourceMap<mson::Element>& SourceMap<mson::Element>::operator=(SourceMap<mson::Elements>&& rhs)
 {
-    m_elements.reset(::new SourceMap<mson::Elements>);
+    m_elements.reset(::new SourceMap<mson::Elements>(std::move(rhs)));
+
+    return *this;
 }
 
+SourceMap<mson::Element>::SourceMap() {}
+
 SourceMap<mson::Element>::SourceMap(const SourceMap<mson::Element>& rhs)
 {
     this->property = rhs.property;
     this->value = rhs.value;
     this->mixin = rhs.mixin;
-    m_elements.reset(::new SourceMap<mson::Elements>(*rhs.m_elements.get()));
+    if (rhs.m_elements.get())
+        m_elements.reset(::new SourceMap<mson::Elements>(*rhs.m_elements.get()));
+}
+
+SourceMap<mson::Element>::SourceMap(SourceMap<mson::Element>&& rhs) noexcept
+    : property(std::move(rhs.property)),
+      value(std::move(rhs.value)),
+      mixin(std::move(rhs.mixin)),
+      m_elements(std::move(rhs.m_elements))
+{
 }
 
 SourceMap<mson::Element>& SourceMap<mson::Element>::operator=(const SourceMap<mson::Element>& rhs)
 {
+    if (this == &rhs)
+        return *this;
+
     this->property = rhs.property;
     this->value = rhs.value;
     this->mixin = rhs.mixin;
-    m_elements.reset(::new SourceMap<mson::Elements>(*rhs.m_elements.get()));
+    m_elements.reset(rhs.m_elements.get() ? ::new SourceMap<mson::Elements>(*rhs.m_elements.get()) : NULL);
+
+    return *this;
+}
+
+SourceMap<mson::Element>& SourceMap<mson::Element>::operator=(SourceMap<mson::Element>&& rhs) noexcept
+{
+    this->property = std::move(rhs.property);
+    this->value = std::move(rhs.value);
+    this->mixin = std::move(rhs.mixin);
+    m_elements = std::move(rhs.m_elements);
 
     return *this;
 }
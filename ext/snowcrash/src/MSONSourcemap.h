@@ -78,9 +78,15 @@ namespace snowcrash
         /** Copy constructor */
         SourceMap(const SourceMap<mson::TypeSection>& rhs);
 
+        /** Move constructor */
+        SourceMap(SourceMap<mson::TypeSection>&& rhs) noexcept;
+
         /** Assignment operator */
         SourceMap<mson::TypeSection>& operator=(const SourceMap<mson::TypeSection>& rhs);
 
+        /** Move assignment operator */
+        SourceMap<mson::TypeSection>& operator=(SourceMap<mson::TypeSection>&& rhs) noexcept;
+
         /** Desctructor */
         ~SourceMap();
 
@@ -162,6 +168,7 @@ namespace snowcrash
 
         /** Builds the structure from group of elements */
         SourceMap<mson::Element>& operator=(const SourceMap<mson::Elements>& rhs);
+        SourceMap<mson::Element>& operator=(SourceMap<mson::Elements>&& rhs);
 
         /** Constructor */
         SourceMap();
@@ -169,9 +176,15 @@ namespace snowcrash
         /** Copy constructor */
         SourceMap(const SourceMap<mson::Element>& rhs);
 
+        /** Move constructor */
+        SourceMap(SourceMap<mson::Element>&& rhs) noexcept;
+
         /** Assignment operator */
         SourceMap<mson::Element>& operator=(const SourceMap<mson::Element>& rhs);
 
+        /** Move assignment operator */
+        SourceMap<mson::Element>& operator=(SourceMap<mson::Element>&& rhs) noexcept;
+
         /** Destructor */
         ~SourceMap();
 
@@ -36,10 +36,10 @@ namespace snowcrash
                     IntermediateParseResult<mson::Mixin> mixin(out.report);
                     cur = MSONMixinParser::parse(node, siblings, pd, mixin);
 
-                    element.build(mixin.node);
+                    element.build(std::move(mixin.node));
 
                     if (pd.exportSourceMap()) {
-                        elementSM.mixin = mixin.sourceMap;
+                        elementSM.mixin = std::move(mixin.sourceMap);
                     }
 
                     break;
@@ -62,10 +62,10 @@ namespace snowcrash
                     IntermediateParseResult<mson::OneOf> oneOf(out.report);
                     cur = MSONOneOfParser::parse(node, siblings, pd, oneOf);
 
-                    element.build(oneOf.node);
+                    element.build(std::move(oneOf.node));
 
                     if (pd.exportSourceMap()) {
-                        elementSM = oneOf.sourceMap;
+                        elementSM = std::move(oneOf.sourceMap);
                     }
 
                     break;
@@ -77,20 +77,20 @@ namespace snowcrash
                         IntermediateParseResult<mson::PropertyMember> propertyMember(out.report);
                         cur = MSONPropertyMemberParser::parse(node, siblings, pd, propertyMember);
 
-                        element.build(propertyMember.node);
+                        element.build(std::move(propertyMember.node));
 
                         if (pd.exportSourceMap()) {
-                            elementSM.property = propertyMember.sourceMap;
+                            elementSM.property = std::move(propertyMember.sourceMap);
                         }
                     } else {
 
                         IntermediateParseResult<mson::ValueMember> valueMember(out.report);
                         cur = MSONValueMemberParser::parse(node, siblings, pd, valueMember);
 
-                        element.build(valueMember.node);
+                        element.build(std::move(valueMember.node));
 
                         if (pd.exportSourceMap()) {
-                            elementSM.value = valueMember.sourceMap;
+                            elementSM.value = std::move(valueMember.sourceMap);
                         }
                     }
 
@@ -124,10 +124,10 @@ namespace snowcrash
                         IntermediateParseResult<mson::ValueMember> valueMember(out.report);
                         cur = MSONValueMemberParser::parse(node, siblings, pd, valueMember);
 
-                        element.build(valueMember.node);
+                        element.build(std::move(valueMember.node));
 
                         if (pd.exportSourceMap()) {
-                            elementSM.value = valueMember.sourceMap;
+                            elementSM.value = std::move(valueMember.sourceMap);
                         }
                     } else if ((out.node.baseType == mson::ObjectBaseType
                                    || out.node.baseType == mson::ImplicitObjectBaseType)
@@ -136,10 +136,10 @@ namespace snowcrash
                         IntermediateParseResult<mson::PropertyMember> propertyMember(out.report);
                         cur = MSONPropertyMemberParser::parse(node, siblings, pd, propertyMember);
 
-                        element.build(propertyMember.node);
+                        element.build(std::move(propertyMember.node));
 
                         if (pd.exportSourceMap()) {
-                            elementSM.property = propertyMember.sourceMap;
+                            elementSM.property = std::move(propertyMember.sourceMap);
                         }
                     }
 
@@ -169,10 +169,10 @@ namespace snowcrash
         }
 
         if (element.klass != mson::Element::UndefinedClass) {
-            out.node.content.elements().push_back(element);
+            out.node.content.elements().push_back(std::move(element));
 
             if (pd.exportSourceMap()) {
-                out.sourceMap.elements().collection.push_back(elementSM);
+                out.sourceMap.elements().collection.push_back(std::move(elementSM));
             }
         }
 
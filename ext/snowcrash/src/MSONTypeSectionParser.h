@@ -117,12 +117,12 @@ namespace snowcrash
                         SourceMap<mson::Element> elementSM;
 
                         element.build(mson::parseValue(signature.values[i]));
-                        out.node.content.elements().push_back(element);
+                        out.node.content.elements().push_back(std::move(element));
 
                         if (pd.exportSourceMap()) {
 
                             elementSM.value.valueDefinition.sourceMap = node->sourceMap;
-                            out.sourceMap.elements().collection.push_back(elementSM);
+                            out.sourceMap.elements().collection.push_back(std::move(elementSM));
                         }
                     }
                 } else if (out.node.baseType == mson::ObjectBaseType
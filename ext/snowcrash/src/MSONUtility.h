@@ -307,6 +307,12 @@ namespace mson
         bool circularCheck = false)
     {
 
+        // Shards add their dependencies in document order once merged
+        if (pd.isShard) {
+            pd.deferredDependencies.push_back({ node, dependency, dependent, circularCheck });
+            return;
+        }
+
         // First, check if the type exists
         if (pd.namedTypeDependencyTable.find(dependency) == pd.namedTypeDependencyTable.end()) {
 
@@ -320,7 +326,7 @@ namespace mson
             return;
         }
 
-        std::set<mson::Literal> dependencyDeps = pd.namedTypeDependencyTable[dependency];
+        mson::NamedTypeDependencies dependencyDeps = pd.namedTypeDependencyTable[dependency];
 
         // Second, check if it is circular reference between them
         if (circularCheck && (dependent == dependency || dependencyDeps.find(dependent) != dependencyDeps.end())) {
@@ -215,14 +215,14 @@ namespace snowcrash
             mson::TypeSection typeSection(mson::TypeSection::BlockDescriptionClass);
 
             typeSection.content.description = remainingContent;
-            sections.push_back(typeSection);
+            sections.push_back(std::move(typeSection));
 
             if (pd.exportSourceMap()) {
 
                 SourceMap<mson::TypeSection> typeSectionSM;
 
                 typeSectionSM.description.sourceMap = node->sourceMap;
-                sourceMap.collection.push_back(typeSectionSM);
+                sourceMap.collection.push_back(std::move(typeSectionSM));
             }
         }
 
@@ -245,13 +245,10 @@ namespace snowcrash
 
                 if (sections.empty()) {
 
-                    mson::TypeSection typeSection(mson::TypeSection::BlockDescriptionClass);
-                    sections.push_back(typeSection);
+                    sections.emplace_back(mson::TypeSection::BlockDescriptionClass);
 
                     if (pd.exportSourceMap()) {
-
-                        SourceMap<mson::TypeSection> typeSectionSM;
-                        sourceMap.collection.push_back(typeSectionSM);
+                        sourceMap.collection.emplace_back();
                     }
                 }
 
@@ -308,7 +305,7 @@ namespace snowcrash
                 cur = PARSER::parse(node, siblings, pd, typeSection);
 
                 if (typeSection.node.klass != mson::TypeSection::UndefinedClass) {
-                    sections.node.push_back(typeSection.node);
+                    sections.node.push_back(std::move(typeSection.node));
 
                     if (pd.exportSourceMap()) {
                         if (typeSection.sourceMap.value.sourceMap.empty()) {
@@ -317,7 +314,7 @@ namespace snowcrash
                                 std::back_inserter(typeSection.sourceMap.value.sourceMap));
                         }
 
-                        sections.sourceMap.collection.push_back(typeSection.sourceMap);
+                        sections.sourceMap.collection.push_back(std::move(typeSection.sourceMap));
                     }
                 }
             }
@@ -10,7 +10,7 @@
 #define SNOWCRASH_MODELTABLE_H
 
 #include <string>
-#include <map>
+#include <unordered_map>
 #include "ByteBuffer.h"
 #include "RegexMatch.h"
 
@@ -31,10 +31,10 @@ namespace snowcrash
     const char* const ModelReferenceRegex("^[[:blank:]]*\\[" SYMBOL_IDENTIFIER "]\\[][[:blank:]]*$");
 
     // Resource Object Model Table
-    typedef std::map<Identifier, ResourceModel> ModelTable;
+    typedef std::unordered_map<Identifier, ResourceModel> ModelTable;
 
     // Resource Object Model Table source map
-    typedef std::map<Identifier, SourceMap<ResourceModel> > ModelSourceMapTable;
+    typedef std::unordered_map<Identifier, SourceMap<ResourceModel> > ModelSourceMapTable;
 
     // Checks whether given source data represents reference to a symbol returning true if so,
     // false otherwise. If source data is represent reference referred symbol name is filled in.
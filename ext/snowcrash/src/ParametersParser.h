@@ -79,8 +79,8 @@ namespace snowcrash
 
                 // Copy values from MSON Parameter to normal parameter
                 parameter.report = msonParameter.report;
-                parameter.node = msonParameter.node;
-                parameter.sourceMap = msonParameter.sourceMap;
+                parameter.node = std::move(msonParameter.node);
+                parameter.sourceMap = std::move(msonParameter.sourceMap);
             } else {
                 return node;
             }
@@ -102,10 +102,10 @@ namespace snowcrash
                 }
             }
 
-            out.node.push_back(parameter.node);
+            out.node.push_back(std::move(parameter.node));
 
             if (pd.exportSourceMap()) {
-                out.sourceMap.collection.push_back(parameter.sourceMap);
+                out.sourceMap.collection.push_back(std::move(parameter.sourceMap));
             }
 
             return ++MarkdownNodeIterator(node);
@@ -0,0 +1,56 @@
+//
+//  ParseStatistics.h
+//  snowcrash
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_PARSESTATISTICS_H
+#define SNOWCRASH_PARSESTATISTICS_H
+
+#include <chrono>
+
+namespace snowcrash
+{
+
+    /** \brief Wall time spent in the stages of parsing, in seconds */
+    struct ParseStatistics {
+
+        /** Parsing the markdown */
+        double markdownTime = 0;
+
+        /** Parsing the blueprint sections, without resolving the lazy references */
+        double sectionsTime = 0;
+
+        /** Resolving the models referenced before being defined */
+        double lazyReferencesTime = 0;
+    };
+
+    /** \brief Adds the wall time of its scope to the counter, does nothing without a counter */
+    class ScopedTimer
+    {
+    public:
+        explicit ScopedTimer(double* counter_) : counter(counter_)
+        {
+            if (counter)
+                start = Clock::now();
+        }
+
+        ~ScopedTimer()
+        {
+            if (counter)
+                *counter += std::chrono::duration<double>(Clock::now() - start).count();
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        typedef std::chrono::steady_clock Clock;
+
+        double* counter;
+        Clock::time_point start;
+    };
+}
+
+#endif
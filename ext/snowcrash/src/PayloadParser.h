@@ -15,6 +15,7 @@
 #include "HeadersParser.h"
 #include "ParametersParser.h"
 #include "AttributesParser.h"
+#include "SourceMapUtility.h"
 
 /** Media type in brackets regex */
 #define MEDIA_TYPE "([[:blank:]]*\\(([^\\)]*)\\))"
@@ -508,12 +509,14 @@ namespace snowcrash
         /** Given the reference id(name), initializes reference of the payload accordingly (if possible resolve it) */
         static bool parseModelReference(const MarkdownNodeIterator& node,
             SectionParserData& pd,
-            mdp::ByteBuffer& source,
+            const mdp::ByteBuffer& text,
             const ParseResultRef<Payload>& out)
         {
 
             Identifier symbol;
 
+            // The markdown nodes are shared by concurrently parsed groups, never trim them in place
+            mdp::ByteBuffer source = text;
             TrimString(source);
 
             if (GetModelReference(source, symbol)) {
@@ -530,6 +533,7 @@ namespace snowcrash
                 if (pd.modelTable.find(symbol) == pd.modelTable.end()) {
 
                     out.node.reference.meta.state = Reference::StatePending;
+                    pd.pendingModelReferences.insert(symbol);
 
                     return true;
                 }
@@ -553,7 +557,7 @@ namespace snowcrash
         {
 
             SourceMap<ResourceModel> modelSM;
-            ResourceModel model = pd.modelTable.find(out.node.reference.id)->second;
+            const ResourceModel& model = pd.modelTable.find(out.node.reference.id)->second;
 
             out.node.description = model.description;
             out.node.parameters = model.parameters;
@@ -590,6 +594,7 @@ namespace snowcrash
             if (pd.exportSourceMap()) {
 
                 modelSM = pd.modelSourceMapTable.at(out.node.reference.id);
+                ShiftSourceMap(modelSM, -static_cast<std::ptrdiff_t>(pd.sourceOffset));
 
                 out.sourceMap.description = modelSM.description;
                 out.sourceMap.parameters = modelSM.parameters;
@@ -71,13 +71,10 @@ namespace snowcrash
                 || (!out.node.content.elements().empty()
                        && out.node.content.elements().back().element != Element::CopyElement)) {
 
-                Element description(Element::CopyElement);
-                out.node.content.elements().push_back(description);
+                out.node.content.elements().emplace_back(Element::CopyElement);
 
                 if (pd.exportSourceMap()) {
-
-                    SourceMap<Element> descriptionSM(Element::CopyElement);
-                    out.sourceMap.content.elements().collection.push_back(descriptionSM);
+                    out.sourceMap.content.elements().collection.emplace_back(Element::CopyElement);
                 }
             }
 
@@ -108,17 +105,11 @@ namespace snowcrash
             if (pd.sectionContext() == ResourceSectionType) {
 
                 IntermediateParseResult<Resource> resource(out.report);
+                size_t firstPending = pd.pendingReferenceLocations.size();
                 cur = ResourceParser::parse(node, siblings, pd, resource);
 
-                bool duplicate = SectionProcessor<Resource>::isResourceDuplicate(
-                    out.node.content.elements(), resource.node.uriTemplate);
-                bool globalDuplicate;
-
-                if (!duplicate) {
-                    globalDuplicate = isResourceDuplicate(pd.blueprint, resource.node.uriTemplate);
-                }
-
-                if (duplicate || globalDuplicate) {
+                // Resources of this group are indexed along with those already in the blueprint
+                if (!pd.resourceURITemplates.insert(resource.node.uriTemplate).second) {
 
                     // WARN: Duplicate resource
                     mdp::CharactersRangeSet sourceMap
@@ -129,17 +120,15 @@ namespace snowcrash
                             sourceMap));
                 }
 
-                Element resourceElement(Element::ResourceElement);
-                resourceElement.content.resource = resource.node;
-
-                out.node.content.elements().push_back(resourceElement);
+                out.node.content.elements().emplace_back(Element::ResourceElement);
+                out.node.content.elements().back().content.resource = std::move(resource.node);
+                pd.locatePendingReferences(
+                    firstPending, &PendingReferenceLocation::resource, out.node.content.elements().size() - 1);
 
                 if (pd.exportSourceMap()) {
 
-                    SourceMap<Element> resourceElementSM(Element::ResourceElement);
-                    resourceElementSM.content.resource = resource.sourceMap;
-
-                    out.sourceMap.content.elements().collection.push_back(resourceElementSM);
+                    out.sourceMap.content.elements().collection.emplace_back(Element::ResourceElement);
+                    out.sourceMap.content.elements().collection.back().content.resource = std::move(resource.sourceMap);
                 }
             }
 
@@ -240,29 +229,6 @@ namespace snowcrash
             return SectionProcessorBase<ResourceGroup>::isUnexpectedNode(node, sectionType);
         }
 
-        /**
-         * \brief Given a blueprint, Check if a resource already exists with the given uri template
-         *
-         * \param blueprint The blueprint which is formed until now
-         * \param uri The resource uri template to be checked
-         */
-        static bool isResourceDuplicate(const Blueprint& blueprint, const URITemplate& uri)
-        {
-            if (SectionProcessor<Resource>::isResourceDuplicate(blueprint.content.elements(), uri)) {
-                return true;
-            }
-
-            for (const auto& element : blueprint.content.elements()) {
-                if (element.element == Element::CategoryElement
-                    && SectionProcessor<Resource>::isResourceDuplicate(element.content.elements(), uri)) {
-
-                    return true;
-                }
-            }
-
-            return false;
-        }
-
         /**
          * \brief Given list of elements, return true if none of them is a resource element
          *
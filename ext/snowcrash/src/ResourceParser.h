@@ -16,6 +16,7 @@
 #include "ParametersParser.h"
 #include "UriTemplateParser.h"
 #include "RegexMatch.h"
+#include "SourceMapUtility.h"
 
 namespace snowcrash
 {
@@ -48,6 +49,9 @@ namespace snowcrash
 
             CaptureGroups captureGroups;
 
+            pd.resourceActions.clear();
+            pd.resourceRelations.clear();
+
             // If Abbreviated resource section
             if (RegexCapture(node->text, ResourceHeaderRegex, captureGroups, 4)) {
 
@@ -117,7 +121,7 @@ namespace snowcrash
 
                     if (!out.node.name.empty()) {
 
-                        if (SectionProcessor<DataStructureGroup>::isNamedTypeDuplicate(pd.blueprint, out.node.name)) {
+                        if (SectionProcessor<DataStructureGroup>::isNamedTypeDuplicate(pd, out.node.name)) {
 
                             // WARN: duplicate named type
                             std::stringstream ss;
@@ -174,7 +178,10 @@ namespace snowcrash
                     it->second.body = out.node.model.body;
 
                     if (pd.exportSourceMap()) {
-                        pd.modelSourceMapTable[out.node.model.name].body = out.sourceMap.model.body;
+                        SourceMap<Asset>& body = pd.modelSourceMapTable[out.node.model.name].body;
+
+                        body = out.sourceMap.model.body;
+                        ShiftSourceMap(body, pd.sourceOffset);
                     }
                 }
 
@@ -282,7 +289,7 @@ namespace snowcrash
                 uriTemplateParser.parse(out.node.uriTemplate, sourceMap, parsedResult);
 
                 if (!parsedResult.report.warnings.empty()) {
-                    out.report += parsedResult.report;
+                    out.report += std::move(parsedResult.report);
                 }
             }
 
@@ -336,13 +343,16 @@ namespace snowcrash
         {
 
             IntermediateParseResult<Action> action(out.report);
+            size_t firstPending = pd.pendingReferenceLocations.size();
             MarkdownNodeIterator cur = ActionParser::parse(node, siblings, pd, action);
 
-            out.node.actions.push_back(action.node);
+            SectionProcessor<Action>::indexAction(pd, action.node);
+            out.node.actions.push_back(std::move(action.node));
+            pd.locatePendingReferences(firstPending, &PendingReferenceLocation::action, out.node.actions.size() - 1);
             layout = RedirectSectionLayout;
 
             if (pd.exportSourceMap()) {
-                out.sourceMap.actions.collection.push_back(action.sourceMap);
+                out.sourceMap.actions.collection.push_back(std::move(action.sourceMap));
                 out.sourceMap.uriTemplate.sourceMap = node->sourceMap;
             }
 
@@ -357,11 +367,10 @@ namespace snowcrash
         {
 
             IntermediateParseResult<Action> action(out.report);
+            size_t firstPending = pd.pendingReferenceLocations.size();
             MarkdownNodeIterator cur = ActionParser::parse(node, siblings, pd, action);
 
-            ActionIterator duplicate = SectionProcessor<Action>::findAction(out.node.actions, action.node);
-
-            if (duplicate != out.node.actions.end()) {
+            if (SectionProcessor<Action>::isActionDuplicate(pd, action.node)) {
 
                 // WARN: duplicate method
                 std::stringstream ss;
@@ -373,10 +382,7 @@ namespace snowcrash
                 out.report.warnings.push_back(Warning(ss.str(), DuplicateWarning, sourceMap));
             }
 
-            ActionIterator relationDuplicate
-                = SectionProcessor<Action>::findRelation(out.node.actions, action.node.relation);
-
-            if (relationDuplicate != out.node.actions.end()) {
+            if (SectionProcessor<Action>::isRelationDuplicate(pd, action.node.relation)) {
 
                 // WARN: duplicate relation identifier
                 std::stringstream ss;
@@ -392,10 +398,12 @@ namespace snowcrash
                 checkParametersEligibility<Resource>(node, pd, action.node.parameters, out);
             }
 
-            out.node.actions.push_back(action.node);
+            SectionProcessor<Action>::indexAction(pd, action.node);
+            out.node.actions.push_back(std::move(action.node));
+            pd.locatePendingReferences(firstPending, &PendingReferenceLocation::action, out.node.actions.size() - 1);
 
             if (pd.exportSourceMap()) {
-                out.sourceMap.actions.collection.push_back(action.sourceMap);
+                out.sourceMap.actions.collection.push_back(std::move(action.sourceMap));
             }
 
             return cur;
@@ -486,7 +494,10 @@ namespace snowcrash
                 pd.modelTable[model.node.name] = model.node;
 
                 if (pd.exportSourceMap()) {
-                    pd.modelSourceMapTable[model.node.name] = model.sourceMap;
+                    SourceMap<ResourceModel>& modelSourceMap = pd.modelSourceMapTable[model.node.name];
+
+                    modelSourceMap = model.sourceMap;
+                    ShiftSourceMap(modelSourceMap, pd.sourceOffset);
                 }
             } else {
 
@@ -499,31 +510,14 @@ namespace snowcrash
                 out.report.error = Error(ss.str(), ModelError, sourceMap);
             }
 
-            out.node.model = model.node;
+            out.node.model = std::move(model.node);
 
             if (pd.exportSourceMap()) {
-                out.sourceMap.model = model.sourceMap;
+                out.sourceMap.model = std::move(model.sourceMap);
             }
 
             return cur;
         }
-
-        /**
-         * \brief Given a list of elements, Check if a resource already exists with the given uri template
-         *
-         * \param elements Collection of elements
-         * \param uri The resource uri template to be checked
-         */
-        static bool isResourceDuplicate(const Elements& elements, const URITemplate& uri)
-        {
-            for (const auto& element : elements) {
-                if (element.element == Element::ResourceElement && element.content.resource.uriTemplate == uri) {
-                    return true;
-                }
-            }
-
-            return false;
-        }
     };
 
     /** Resource Section Parser */
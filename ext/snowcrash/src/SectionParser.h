@@ -11,6 +11,7 @@
 
 #include <stdexcept>
 #include "SignatureSectionProcessor.h"
+#include "Tracing.h"
 
 namespace snowcrash
 {
@@ -34,6 +35,7 @@ namespace snowcrash
             SectionParserData& pd,
             const ParseResultRef<T>& out)
         {
+            TRACE_SPAN_DETAIL("SectionParser::parse", SectionName(pd.sectionContext()) + ": " + node->text);
 
             SectionLayout layout = DefaultSectionLayout;
             MarkdownNodeIterator cur = Adapter::startingNode(node, pd);
@@ -99,15 +101,34 @@ namespace snowcrash
             const ParseResultRef<T>& out)
         {
 
+            SectionProcessor<T>::preprocessNestedSections(node, collection, pd, out);
+
+            return parseNestedSections(node, collection.end(), collection, pd, out);
+        }
+
+        /**
+         *  \brief  Parse nested sections up to the given node, without preprocessing them
+         *  \param  node    Initial node to start parsing at
+         *  \param  end     Node to stop parsing at, a section going past it stops the parsing as well
+         *  \param  collection  Siblings of the initial node
+         *  \param  pd      Parser data
+         *  \param  T       Parsed output
+         *  \return Iterator to the first unparsed block
+         */
+        static MarkdownNodeIterator parseNestedSections(const MarkdownNodeIterator& node,
+            const MarkdownNodes::const_iterator& end,
+            const MarkdownNodes& collection,
+            SectionParserData& pd,
+            const ParseResultRef<T>& out)
+        {
+
             MarkdownNodeIterator cur = node;
             MarkdownNodeIterator lastCur = cur;
 
             SectionType lastSectionType = UndefinedSectionType;
 
-            SectionProcessor<T>::preprocessNestedSections(node, collection, pd, out);
-
             // Nested sections
-            while (cur != collection.end()) {
+            while (cur < end && cur != collection.end()) {
 
                 lastCur = cur;
                 SectionType nestedType = SectionProcessor<T>::nestedSectionType(cur);
@@ -9,9 +9,12 @@
 #ifndef SNOWCRASH_SECTIONPARSERDATA_H
 #define SNOWCRASH_SECTIONPARSERDATA_H
 
+#include <unordered_set>
+#include <vector>
 #include "ModelTable.h"
 #include "BlueprintSourcemap.h"
 #include "Section.h"
+#include "ParseStatistics.h"
 
 namespace snowcrash
 {
@@ -25,11 +28,45 @@ namespace snowcrash
     {
         RenderDescriptionsOption = (1 << 0),   /// < Render Markdown in description.
         RequireBlueprintNameOption = (1 << 1), /// < Treat missing blueprint name as error
-        ExportSourcemapOption = (1 << 2)       /// < Export source maps AST
+        ExportSourcemapOption = (1 << 2),      /// < Export source maps AST
+        ParallelParseOption = (1 << 3),        /// < Parse top-level groups concurrently
+        NormalizeSourceOption = (1 << 4)       /// < Normalize tabs and line endings instead of treating them as error
     };
 
     typedef unsigned int BlueprintParserOptions;
 
+    /**
+     *  \brief Named type dependency recorded while parsing a shard
+     *
+     *  Added to the dependency table once the shard is merged, see %SectionParserData::isShard.
+     */
+    struct DeferredDependency {
+        mdp::MarkdownNodeIterator node;
+        mson::Literal dependency;
+        mson::Literal dependent;
+        bool circularCheck;
+    };
+
+    /**
+     *  \brief Location of a payload referencing a model not defined yet
+     *
+     *  Indices into the blueprint, filled in by each enclosing section once the payload is placed.
+     */
+    struct PendingReferenceLocation {
+
+        /** Index of the resource in the element, %ElementIsResource if the element is the resource itself */
+        static const size_t ElementIsResource = static_cast<size_t>(-1);
+
+        size_t element;
+        size_t resource;
+        size_t action;
+        size_t example;
+        size_t payload;
+        bool request;
+    };
+
+    typedef std::vector<PendingReferenceLocation> PendingReferenceLocations;
+
     /**
      *  \brief Section Parser Data
      *
@@ -37,7 +74,26 @@ namespace snowcrash
      */
     struct SectionParserData {
         SectionParserData(BlueprintParserOptions opts, const mdp::ByteBuffer& src, const Blueprint& bp)
-            : options(opts), sourceData(src), blueprint(bp)
+            : options(opts), sourceData(src), sourceCharacterIndex(characterIndex), blueprint(bp)
+        {
+        }
+
+        /**
+         *  \brief Create state for parsing a shard of the nested sections
+         *
+         *  The shard gets a copy of the named type tables and shares the
+         *  source character index with its parent.
+         */
+        SectionParserData(const SectionParserData& parent, const Blueprint& bp)
+            : options(parent.options & ~ParallelParseOption),
+              namedTypeBaseTable(parent.namedTypeBaseTable),
+              namedTypeInheritanceTable(parent.namedTypeInheritanceTable),
+              namedTypeDependencyTable(parent.namedTypeDependencyTable),
+              sourceData(parent.sourceData),
+              sourceOffset(parent.sourceOffset),
+              sourceCharacterIndex(parent.sourceCharacterIndex),
+              blueprint(bp),
+              isShard(true)
         {
         }
 
@@ -56,24 +112,78 @@ namespace snowcrash
         /** Table mapping named types to their dependent named types */
         mson::NamedTypeDependencyTable namedTypeDependencyTable;
 
+        /** True if the named type tables are filled and resolved in advance, when parsing a stream in parts */
+        bool namedTypesGathered = false;
+
         /** Variable to store the current named type */
         mson::Literal namedTypeContext;
 
         /** Model Table */
         ModelTable modelTable;
 
-        /** Model Table Sourcemap */
+        /** Model Table Sourcemap, relative to the whole source, see %sourceOffset */
         ModelSourceMapTable modelSourceMapTable;
 
+        /** Models referenced before being defined, the references are resolved once the blueprint is parsed */
+        std::unordered_set<Identifier> pendingModelReferences;
+
+        /** Locations of the payloads with a pending model reference, resolved along with %pendingModelReferences */
+        PendingReferenceLocations pendingReferenceLocations;
+
+        /** Sets the index of the enclosing section for the pending reference locations recorded since the first */
+        void locatePendingReferences(size_t first, size_t PendingReferenceLocation::*index, size_t value)
+        {
+            for (size_t i = first; i < pendingReferenceLocations.size(); ++i) {
+                pendingReferenceLocations[i].*index = value;
+            }
+        }
+
         /** Source Data */
         const mdp::ByteBuffer& sourceData;
 
+        /** Offset of the source data in the whole source, non-zero when parsing a part of a stream */
+        size_t sourceOffset = 0;
+
+        /** Statistics of the parsing, if requested, not available to shards */
+        ParseStatistics* statistics = nullptr;
+
+    private:
+        /** Storage of the source character index */
+        mdp::ByteBufferCharacterIndex characterIndex;
+
+    public:
         /** Source - map of bytes to character position - performance optimization */
-        mdp::ByteBufferCharacterIndex sourceCharacterIndex;
+        mdp::ByteBufferCharacterIndex& sourceCharacterIndex;
 
         /** AST being parsed **/
         const Blueprint& blueprint;
 
+        /** Names of resource groups in the AST being parsed */
+        std::unordered_set<mdp::ByteBuffer> resourceGroupNames;
+
+        /** Names of named types (data structures and resource attributes) in the AST being parsed */
+        std::unordered_set<mdp::ByteBuffer> namedTypeNames;
+
+        /** URI templates of all resources parsed so far */
+        std::unordered_set<URITemplate> resourceURITemplates;
+
+        /** Method and URI template of actions parsed so far in the current resource */
+        std::unordered_set<std::string> resourceActions;
+
+        /** Relation identifiers of actions parsed so far in the current resource */
+        std::unordered_set<std::string> resourceRelations;
+
+        /**
+         *  True if parsing a shard of the nested sections concurrently with other shards.
+         *
+         *  A shard does not see the named type dependencies added by the preceding shards,
+         *  it records them in %deferredDependencies instead.
+         */
+        bool isShard = false;
+
+        /** Named type dependencies to be added once the shard is merged */
+        std::vector<DeferredDependency> deferredDependencies;
+
         /** Sections Context */
         typedef std::vector<SectionType> SectionsStack;
         SectionsStack sectionsContext;
@@ -9,7 +9,9 @@
 #ifndef SNOWCRASH_SOURCEANNOTATION_H
 #define SNOWCRASH_SOURCEANNOTATION_H
 
+#include <iterator>
 #include <string>
+#include <utility>
 #include <vector>
 #include "ByteBuffer.h"
 
@@ -40,47 +42,42 @@ namespace snowcrash
          *  \brief  %SourceAnnotation copy constructor.
          *  \param  rhs  An annotation to be copied.
          */
-        SourceAnnotation(const SourceAnnotation& rhs)
-        {
+        SourceAnnotation(const SourceAnnotation& rhs) = default;
 
-            this->message = rhs.message;
-            this->code = rhs.code;
-            this->location = rhs.location;
-        }
+        /**
+         *  \brief  %SourceAnnotation move constructor.
+         *  \param  rhs  An annotation to be moved.
+         */
+        SourceAnnotation(SourceAnnotation&& rhs) noexcept = default;
 
         /**
          *  \brief  %SourceAnnotation constructor.
          *  \param  message     An annotation message.
          *  \param  code        Annotation code.
          *  \param  location    A location of the annotation.
+         *
+         *  Both the message and the location are moved into the annotation when passed as temporaries.
          */
-        SourceAnnotation(const std::string& message,
-            int code = OK,
-            const mdp::CharactersRangeSet& location = mdp::CharactersRangeSet())
+        SourceAnnotation(
+            std::string message, int code = OK, mdp::CharactersRangeSet location = mdp::CharactersRangeSet())
+            : location(std::move(location)), code(code), message(std::move(message))
         {
-
-            this->message = message;
-            this->code = code;
-
-            this->location.clear();
-            if (!location.empty())
-                this->location.assign(location.begin(), location.end());
         }
 
         /** \brief  %SourceAnnotation destructor. */
-        ~SourceAnnotation() {}
+        ~SourceAnnotation() = default;
 
         /**
          *  \brief  %SourceAnnotation assignment operator
          *  \param  rhs  An annotation to be assigned to this annotation.
          */
-        SourceAnnotation& operator=(const SourceAnnotation& rhs)
-        {
-            this->message = rhs.message;
-            this->code = rhs.code;
-            this->location = rhs.location;
-            return *this;
-        }
+        SourceAnnotation& operator=(const SourceAnnotation& rhs) = default;
+
+        /**
+         *  \brief  %SourceAnnotation move assignment operator
+         *  \param  rhs  An annotation to be moved to this annotation.
+         */
+        SourceAnnotation& operator=(SourceAnnotation&& rhs) noexcept = default;
 
         /** The location of this annotation within the source data buffer. */
         mdp::CharactersRangeSet location;
@@ -161,6 +158,20 @@ namespace snowcrash
             return *this;
         }
 
+        /**
+         *  \brief Move a report to the end of this one, replacing the error source annotation.
+         *
+         *  NOTE: A binding does not need to wrap this action.
+         */
+        Report& operator+=(Report&& rhs)
+        {
+            error = std::move(rhs.error);
+            warnings.insert(warnings.end(),
+                std::make_move_iterator(rhs.warnings.begin()),
+                std::make_move_iterator(rhs.warnings.end()));
+            return *this;
+        }
+
         /** Result error source annotation */
         Error error;
 
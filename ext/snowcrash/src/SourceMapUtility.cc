@@ -0,0 +1,184 @@
+//
+//  SourceMapUtility.cc
+//  snowcrash
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#include "SourceMapUtility.h"
+
+using namespace snowcrash;
+
+static void Translate(SourceMapBase& sourceMap, const SourceMapTranslation& translation)
+{
+    for (auto& range : sourceMap.sourceMap) {
+        translation(range);
+    }
+}
+
+static void Translate(SourceMap<mson::Element>& sourceMap, const SourceMapTranslation& translation);
+static void Translate(SourceMap<mson::TypeSection>& sourceMap, const SourceMapTranslation& translation);
+static void Translate(SourceMap<Parameter>& sourceMap, const SourceMapTranslation& translation);
+static void Translate(SourceMap<Payload>& sourceMap, const SourceMapTranslation& translation);
+static void Translate(SourceMap<TransactionExample>& sourceMap, const SourceMapTranslation& translation);
+static void Translate(SourceMap<Action>& sourceMap, const SourceMapTranslation& translation);
+static void Translate(SourceMap<Element>& sourceMap, const SourceMapTranslation& translation);
+
+template <typename T>
+static void TranslateCollection(SourceMap<T>& sourceMap, const SourceMapTranslation& translation)
+{
+    for (auto& item : sourceMap.collection) {
+        Translate(item, translation);
+    }
+}
+
+static void Translate(SourceMap<mson::Elements>& sourceMap, const SourceMapTranslation& translation)
+{
+    TranslateCollection(sourceMap, translation);
+}
+
+static void Translate(SourceMap<mson::TypeSection>& sourceMap, const SourceMapTranslation& translation)
+{
+    Translate(static_cast<SourceMapBase&>(sourceMap), translation);
+    Translate(sourceMap.description, translation);
+    Translate(sourceMap.value, translation);
+
+    // Avoid allocating the lazily created elements
+    if (!static_cast<const SourceMap<mson::TypeSection>&>(sourceMap).elements().collection.empty())
+        Translate(sourceMap.elements(), translation);
+}
+
+static void Translate(SourceMap<mson::TypeSections>& sourceMap, const SourceMapTranslation& translation)
+{
+    TranslateCollection(sourceMap, translation);
+}
+
+static void Translate(SourceMap<mson::ValueMember>& sourceMap, const SourceMapTranslation& translation)
+{
+    Translate(static_cast<SourceMapBase&>(sourceMap), translation);
+    Translate(sourceMap.description, translation);
+    Translate(sourceMap.valueDefinition, translation);
+    Translate(sourceMap.sections, translation);
+}
+
+static void Translate(SourceMap<mson::PropertyMember>& sourceMap, const SourceMapTranslation& translation)
+{
+    Translate(static_cast<SourceMap<mson::ValueMember>&>(sourceMap), translation);
+    Translate(sourceMap.name, translation);
+}
+
+static void Translate(SourceMap<mson::Element>& sourceMap, const SourceMapTranslation& translation)
+{
+    const SourceMap<mson::Element>& constSourceMap = sourceMap;
+
+    Translate(static_cast<SourceMapBase&>(sourceMap), translation);
+    Translate(sourceMap.property, translation);
+    Translate(sourceMap.value, translation);
+    Translate(sourceMap.mixin, translation);
+
+    // One of and elements share the lazily created storage
+    if (!constSourceMap.elements().collection.empty())
+        Translate(sourceMap.elements(), translation);
+}
+
+static void Translate(SourceMap<mson::NamedType>& sourceMap, const SourceMapTranslation& translation)
+{
+    Translate(static_cast<SourceMapBase&>(sourceMap), translation);
+    Translate(sourceMap.name, translation);
+    Translate(sourceMap.typeDefinition, translation);
+    Translate(sourceMap.sections, translation);
+}
+
+static void Translate(SourceMap<Parameter>& sourceMap, const SourceMapTranslation& translation)
+{
+    Translate(static_cast<SourceMapBase&>(sourceMap), translation);
+    Translate(sourceMap.name, translation);
+    Translate(sourceMap.description, translation);
+    Translate(sourceMap.type, translation);
+    Translate(sourceMap.use, translation);
+    Translate(sourceMap.defaultValue, translation);
+    Translate(sourceMap.exampleValue, translation);
+    TranslateCollection(sourceMap.values, translation);
+}
+
+static void Translate(SourceMap<Payload>& sourceMap, const SourceMapTranslation& translation)
+{
+    Translate(static_cast<SourceMapBase&>(sourceMap), translation);
+    Translate(sourceMap.name, translation);
+    Translate(sourceMap.description, translation);
+    TranslateCollection(sourceMap.parameters, translation);
+    TranslateCollection(sourceMap.headers, translation);
+    Translate(sourceMap.attributes, translation);
+    Translate(sourceMap.body, translation);
+    Translate(sourceMap.schema, translation);
+    Translate(sourceMap.reference, translation);
+}
+
+static void Translate(SourceMap<TransactionExample>& sourceMap, const SourceMapTranslation& translation)
+{
+    Translate(static_cast<SourceMapBase&>(sourceMap), translation);
+    Translate(sourceMap.name, translation);
+    Translate(sourceMap.description, translation);
+    TranslateCollection(sourceMap.requests, translation);
+    TranslateCollection(sourceMap.responses, translation);
+}
+
+static void Translate(SourceMap<Action>& sourceMap, const SourceMapTranslation& translation)
+{
+    Translate(static_cast<SourceMapBase&>(sourceMap), translation);
+    Translate(sourceMap.method, translation);
+    Translate(sourceMap.name, translation);
+    Translate(sourceMap.description, translation);
+    TranslateCollection(sourceMap.parameters, translation);
+    Translate(sourceMap.attributes, translation);
+    Translate(sourceMap.uriTemplate, translation);
+    Translate(sourceMap.relation, translation);
+    TranslateCollection(sourceMap.headers, translation);
+    TranslateCollection(sourceMap.examples, translation);
+}
+
+static void Translate(SourceMap<Resource>& sourceMap, const SourceMapTranslation& translation)
+{
+    Translate(static_cast<SourceMapBase&>(sourceMap), translation);
+    Translate(sourceMap.uriTemplate, translation);
+    Translate(sourceMap.name, translation);
+    Translate(sourceMap.description, translation);
+    Translate(sourceMap.model, translation);
+    Translate(sourceMap.attributes, translation);
+    TranslateCollection(sourceMap.parameters, translation);
+    TranslateCollection(sourceMap.headers, translation);
+    TranslateCollection(sourceMap.actions, translation);
+}
+
+static void Translate(SourceMap<Element>& sourceMap, const SourceMapTranslation& translation)
+{
+    Translate(static_cast<SourceMapBase&>(sourceMap), translation);
+    Translate(sourceMap.attributes.name, translation);
+    Translate(sourceMap.content.copy, translation);
+    Translate(sourceMap.content.resource, translation);
+    Translate(sourceMap.content.dataStructure, translation);
+
+    // Avoid allocating the lazily created elements
+    const SourceMap<Element>::Content& content = sourceMap.content;
+
+    if (!content.elements().collection.empty())
+        TranslateCollection(sourceMap.content.elements(), translation);
+}
+
+void snowcrash::TranslateSourceMap(SourceMap<Blueprint>& sourceMap, const SourceMapTranslation& translation)
+{
+    Translate(static_cast<SourceMap<Element>&>(sourceMap), translation);
+    Translate(sourceMap.name, translation);
+    TranslateCollection(sourceMap.metadata, translation);
+    Translate(sourceMap.description, translation);
+}
+
+void snowcrash::TranslateSourceMap(SourceMap<Payload>& sourceMap, const SourceMapTranslation& translation)
+{
+    Translate(sourceMap, translation);
+}
+
+void snowcrash::TranslateSourceMap(SourceMapBase& sourceMap, const SourceMapTranslation& translation)
+{
+    Translate(sourceMap, translation);
+}
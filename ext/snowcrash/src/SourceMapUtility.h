@@ -0,0 +1,58 @@
+//
+//  SourceMapUtility.h
+//  snowcrash
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_SOURCEMAPUTILITY_H
+#define SNOWCRASH_SOURCEMAPUTILITY_H
+
+#include <cstddef>
+#include <functional>
+
+#include "BlueprintSourcemap.h"
+#include "SourceAnnotation.h"
+
+namespace snowcrash
+{
+
+    /** Function translating a range of a source map in place */
+    typedef std::function<void(mdp::BytesRange&)> SourceMapTranslation;
+
+    /**
+     *  \brief Apply the translation to every range of the source map
+     *
+     *  Walks the whole source map AST, including nested MSON elements.
+     */
+    void TranslateSourceMap(SourceMap<Blueprint>& sourceMap, const SourceMapTranslation& translation);
+    void TranslateSourceMap(SourceMap<Payload>& sourceMap, const SourceMapTranslation& translation);
+
+    /** Apply the translation to the ranges of a source map without nested source maps */
+    void TranslateSourceMap(SourceMapBase& sourceMap, const SourceMapTranslation& translation);
+
+    /**
+     *  \brief Move every range of the source map by the offset
+     *
+     *  Offsets are added modulo size_t, moving ranges by a negative offset
+     *  and back by the opposite one gives the original ranges.
+     */
+    template <typename T>
+    void ShiftSourceMap(SourceMap<T>& sourceMap, std::ptrdiff_t offset)
+    {
+        if (offset == 0)
+            return;
+
+        TranslateSourceMap(sourceMap, [offset](mdp::BytesRange& range) { range.location += offset; });
+    }
+
+    /** Move every range of the annotation by the offset */
+    inline void ShiftAnnotation(SourceAnnotation& annotation, std::ptrdiff_t offset)
+    {
+        for (auto& range : annotation.location) {
+            range.location += offset;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,181 @@
+//
+//  Tracing.cc
+//  snowcrash
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "Tracing.h"
+
+using namespace snowcrash;
+using namespace snowcrash::trace;
+
+std::atomic<bool> snowcrash::trace::enabled(false);
+
+namespace
+{
+    /** Ring buffer of the spans recorded by a thread */
+    struct Buffer {
+        explicit Buffer(size_t thread_) : events(BufferCapacity), recorded(0), thread(thread_) {}
+
+        std::vector<Event> events;
+        size_t recorded;
+        size_t thread;
+
+        size_t size() const
+        {
+            return std::min(recorded, events.size());
+        }
+
+        const Event& operator[](size_t i) const
+        {
+            // The oldest span is overwritten first
+            size_t first = recorded > events.size() ? recorded % events.size() : 0;
+            return events[(first + i) % events.size()];
+        }
+    };
+
+    typedef std::vector<std::shared_ptr<Buffer> > Buffers;
+
+    std::mutex& buffersMutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    Buffers& buffers()
+    {
+        static Buffers all;
+        return all;
+    }
+
+    /** Buffer of the current thread, registered on the first recorded span of the thread */
+    Buffer& threadBuffer()
+    {
+        static thread_local std::shared_ptr<Buffer> buffer;
+        static size_t threads = 0;
+
+        if (!buffer) {
+            std::lock_guard<std::mutex> lock(buffersMutex());
+
+            buffer = std::make_shared<Buffer>(++threads);
+            buffers().push_back(buffer);
+        }
+
+        return *buffer;
+    }
+
+    void writeString(std::ostream& out, const char* text, size_t length)
+    {
+        out << '"';
+
+        for (size_t i = 0; i < length; ++i) {
+
+            unsigned char c = static_cast<unsigned char>(text[i]);
+
+            if (c == '"' || c == '\\') {
+                out << '\\' << c;
+            } else if (c < 0x20) {
+                out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+            } else {
+                out << c;
+            }
+        }
+
+        out << '"';
+    }
+
+    /** Write the timestamp relative to the origin in microseconds */
+    void writeMicroseconds(std::ostream& out, Timestamp value)
+    {
+        out << value / 1000 << '.' << std::setw(3) << std::setfill('0') << value % 1000;
+    }
+}
+
+void snowcrash::trace::enable(bool value) noexcept
+{
+    enabled.store(value, std::memory_order_relaxed);
+}
+
+void snowcrash::trace::record(
+    const char* name, Timestamp begin, Timestamp end, const char* detail, size_t length) noexcept
+{
+    Buffer& buffer = threadBuffer();
+    Event& event = buffer.events[buffer.recorded % buffer.events.size()];
+
+    event.name = name;
+    event.begin = begin;
+    event.end = end;
+    event.length = std::min(length, DetailSize);
+    std::memcpy(event.detail, detail, event.length);
+
+    ++buffer.recorded;
+}
+
+void snowcrash::trace::clear()
+{
+    std::lock_guard<std::mutex> lock(buffersMutex());
+
+    // Buffers of the finished threads are owned only by the registry
+    buffers().erase(std::remove_if(buffers().begin(),
+                        buffers().end(),
+                        [](const std::shared_ptr<Buffer>& buffer) { return buffer.use_count() == 1; }),
+        buffers().end());
+
+    for (auto& buffer : buffers()) {
+        buffer->recorded = 0;
+    }
+}
+
+size_t snowcrash::trace::writeChromeTrace(std::ostream& out)
+{
+    std::lock_guard<std::mutex> lock(buffersMutex());
+
+    Timestamp origin = std::numeric_limits<Timestamp>::max();
+
+    for (const auto& buffer : buffers()) {
+        for (size_t i = 0; i < buffer->size(); ++i) {
+            origin = std::min(origin, (*buffer)[i].begin);
+        }
+    }
+
+    size_t written = 0;
+
+    out << "{\"traceEvents\":[";
+
+    for (const auto& buffer : buffers()) {
+        for (size_t i = 0; i < buffer->size(); ++i) {
+
+            const Event& event = (*buffer)[i];
+
+            out << (written ? ",\n" : "\n");
+            out << "{\"name\":";
+            writeString(out, event.name, std::strlen(event.name));
+            out << ",\"cat\":\"drafter\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->thread;
+            out << ",\"ts\":";
+            writeMicroseconds(out, event.begin - origin);
+            out << ",\"dur\":";
+            writeMicroseconds(out, event.end - event.begin);
+
+            if (event.length) {
+                out << ",\"args\":{\"detail\":";
+                writeString(out, event.detail, event.length);
+                out << "}";
+            }
+
+            out << "}";
+            ++written;
+        }
+    }
+
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    return written;
+}
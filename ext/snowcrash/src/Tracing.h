@@ -0,0 +1,149 @@
+//
+//  Tracing.h
+//  snowcrash
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#ifndef SNOWCRASH_TRACING_H
+#define SNOWCRASH_TRACING_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#ifdef DISABLE_TRACING
+#define TRACE_SPAN(name)
+#define TRACE_SPAN_DETAIL(name, detail)
+#else
+#define TRACE_SPAN_VARIABLE_CAT(a, b) a##b
+#define TRACE_SPAN_VARIABLE(line) TRACE_SPAN_VARIABLE_CAT(traceSpan, line)
+
+/** Trace the rest of the scope as a span of the name */
+#define TRACE_SPAN(name) snowcrash::trace::Span TRACE_SPAN_VARIABLE(__LINE__)(name)
+
+/** Trace the rest of the scope as a span of the name, the detail is evaluated only while tracing */
+#define TRACE_SPAN_DETAIL(name, detail)                                                                                \
+    snowcrash::trace::Span TRACE_SPAN_VARIABLE(__LINE__)(name);                                                        \
+    if (TRACE_SPAN_VARIABLE(__LINE__))                                                                                 \
+    TRACE_SPAN_VARIABLE(__LINE__).setDetail(detail)
+#endif
+
+namespace snowcrash
+{
+    namespace trace
+    {
+
+        /** Nanoseconds of the steady clock */
+        typedef uint64_t Timestamp;
+
+        /** Maximum length of a span detail, longer details are truncated */
+        const size_t DetailSize = 48;
+
+        /** Number of spans kept per thread, the oldest spans are overwritten */
+        const size_t BufferCapacity = 1 << 16;
+
+        /** \brief Recorded span */
+        struct Event {
+            const char* name;
+            Timestamp begin;
+            Timestamp end;
+            size_t length;
+            char detail[DetailSize];
+        };
+
+        extern std::atomic<bool> enabled;
+
+        /** \returns True if the spans are being recorded */
+        inline bool isEnabled() noexcept
+        {
+            return enabled.load(std::memory_order_relaxed);
+        }
+
+        /** Start or stop recording the spans */
+        void enable(bool value = true) noexcept;
+
+        /** \returns Current timestamp */
+        inline Timestamp now() noexcept
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+        }
+
+        /** Record a span into the buffer of the current thread */
+        void record(const char* name, Timestamp begin, Timestamp end, const char* detail, size_t length) noexcept;
+
+        /** Discard the recorded spans of all threads and the buffers of the finished threads */
+        void clear();
+
+        /**
+         *  \brief Write the recorded spans in the Chrome trace event format
+         *
+         *  Must not be called while other threads are recording.
+         *
+         *  \returns Number of written spans
+         */
+        size_t writeChromeTrace(std::ostream& out);
+
+        /** \brief Records its scope as a span, does nothing while tracing is disabled */
+        class Span
+        {
+        public:
+            explicit Span(const char* name_) noexcept : name(isEnabled() ? name_ : nullptr), begin(0), length(0)
+            {
+                if (name)
+                    begin = now();
+            }
+
+            ~Span()
+            {
+                if (name)
+                    record(name, begin, now(), detail, length);
+            }
+
+            Span(const Span&) = delete;
+            Span& operator=(const Span&) = delete;
+
+            /** \returns True if the span is being recorded */
+            explicit operator bool() const noexcept
+            {
+                return name != nullptr;
+            }
+
+            /** Set the detail of the span, only its first line is kept */
+            void setDetail(const char* text, size_t size) noexcept
+            {
+                length = 0;
+
+                while (length < size && length < DetailSize && text[length] != '\n') {
+                    detail[length] = text[length];
+                    ++length;
+                }
+
+                // Do not split a multibyte character
+                if (length < size && text[length] != '\n') {
+                    while (length > 0 && (static_cast<unsigned char>(text[length]) & 0xC0) == 0x80) {
+                        --length;
+                    }
+                }
+            }
+
+            void setDetail(const std::string& text) noexcept
+            {
+                setDetail(text.data(), text.size());
+            }
+
+        private:
+            const char* name;
+            Timestamp begin;
+            size_t length;
+            char detail[DetailSize];
+        };
+    }
+}
+
+#endif
@@ -6,82 +6,483 @@
 //  Copyright (c) 2013 Apiary Inc. All rights reserved.
 //
 
+#include <algorithm>
+#include <iterator>
 #include "snowcrash.h"
 #include "BlueprintParser.h"
+#include "SourceMapUtility.h"
 
 const int snowcrash::SourceAnnotation::OK = 0;
 
 using namespace snowcrash;
 
 /**
- *  \brief  Check source for unsupported character \t & \r
+ *  \brief  Check scanned source for unsupported character \t & \r
  *  \return True if passed (not found), false otherwise
  */
-static bool CheckSource(const mdp::ByteBuffer& source, Report& report)
+static bool CheckSource(const mdp::ByteBufferScan& scan, Report& report)
 {
-
-    std::string::size_type pos = source.find("\t");
-
-    if (pos != std::string::npos) {
+    if (scan.firstTab != mdp::ByteBuffer::npos) {
 
         mdp::BytesRangeSet rangeSet;
-        rangeSet.push_back(mdp::BytesRange(pos, 1));
+        rangeSet.push_back(mdp::BytesRange(scan.firstTab, 1));
         report.error = Error("the use of tab(s) '\\t' in source data isn't currently supported, please contact makers",
             BusinessError,
-            mdp::BytesRangeSetToCharactersRangeSet(rangeSet, source));
+            mdp::BytesRangeSetToCharactersRangeSet(rangeSet, scan.characterIndex));
         return false;
     }
 
-    pos = source.find("\r");
-
-    if (pos != std::string::npos) {
+    if (scan.firstCarriageReturn != mdp::ByteBuffer::npos) {
 
         mdp::BytesRangeSet rangeSet;
-        rangeSet.push_back(mdp::BytesRange(pos, 1));
+        rangeSet.push_back(mdp::BytesRange(scan.firstCarriageReturn, 1));
         report.error = Error(
             "the use of carriage return(s) '\\r' in source data isn't currently supported, please contact makers",
             BusinessError,
-            mdp::BytesRangeSetToCharactersRangeSet(rangeSet, source));
+            mdp::BytesRangeSetToCharactersRangeSet(rangeSet, scan.characterIndex));
         return false;
     }
 
     return true;
 }
 
-int snowcrash::parse(
-    const mdp::ByteBuffer& source, BlueprintParserOptions options, const ParseResultRef<Blueprint>& out)
+/**
+ *  \brief  Scan the source once, keeping its indexes in the parser data
+ *  \return True if the source passed the check, false otherwise
+ */
+static bool ScanSource(const mdp::ByteBuffer& source, SectionParserData& pd, Report& report)
+{
+    mdp::ByteBufferScan scan;
+    mdp::ScanByteBuffer(scan, source);
+
+    bool passed = CheckSource(scan, report);
+
+    pd.sourceCharacterIndex.swap(scan.characterIndex);
+
+    return passed;
+}
+
+/** Run the parsing, reporting any exception as an error */
+template <typename Parse>
+static void ReportExceptions(Report& report, const Parse& parse)
 {
     try {
+        parse();
+    } catch (const Error& e) {
+        report.error = e;
+    } catch (const std::exception& e) {
 
-        // Sanity Check
-        if (!CheckSource(source, out.report))
-            return out.report.error.code;
+        std::stringstream ss;
+        ss << "parser exception: '" << e.what() << "'";
+        report.error = Error(ss.str(), ApplicationError);
+    } catch (...) {
+        report.error = Error("parser exception has occurred", ApplicationError);
+    }
+}
 
-        // Do nothing if blueprint is empty
-        if (source.empty())
-            return out.report.error.code;
+/** \returns True if the scanned source has no tabs or carriage returns */
+static bool IsNormalized(const mdp::ByteBufferScan& scan)
+{
+    return scan.firstTab == mdp::ByteBuffer::npos && scan.firstCarriageReturn == mdp::ByteBuffer::npos;
+}
+
+/** Parse the scanned source, the indexes are handed back to the scan once done */
+static void ParseScanned(const mdp::ByteBuffer& source,
+    mdp::ByteBufferScan& scan,
+    BlueprintParserOptions options,
+    const ParseResultRef<Blueprint>& out,
+    ParseStatistics* statistics)
+{
+    if (!CheckSource(scan, out.report))
+        return;
+
+    // Do nothing if blueprint is empty
+    if (source.empty())
+        return;
+
+    // Build SectionParserData
+    SectionParserData pd(options, source, out.node);
+    pd.sourceCharacterIndex.swap(scan.characterIndex);
+    pd.statistics = statistics;
+
+    double lazyReferencesTime = statistics ? statistics->lazyReferencesTime : 0;
+    double blueprintTime = 0;
+
+    ReportExceptions(out.report, [&]() {
 
         // Parse Markdown
         mdp::MarkdownParser markdownParser;
         mdp::MarkdownNode markdownAST;
-        markdownParser.parse(source, markdownAST);
 
-        // Build SectionParserData
-        SectionParserData pd(options, source, out.node);
-        mdp::BuildCharacterIndex(pd.sourceCharacterIndex, source);
+        {
+            ScopedTimer timer(statistics ? &statistics->markdownTime : nullptr);
+            markdownParser.parse(source, markdownAST);
+        }
 
         // Parse Blueprint
+        ScopedTimer timer(statistics ? &blueprintTime : nullptr);
         BlueprintParser::parse(markdownAST.children().begin(), markdownAST.children(), pd, out);
-    } catch (const Error& e) {
-        out.report.error = e;
-    } catch (const std::exception& e) {
+    });
 
-        std::stringstream ss;
-        ss << "parser exception: '" << e.what() << "'";
-        out.report.error = Error(ss.str(), ApplicationError);
-    } catch (...) {
-        out.report.error = Error("parser exception has occurred", ApplicationError);
+    // Lazy references are resolved as a part of the blueprint
+    if (statistics)
+        statistics->sectionsTime += blueprintTime - (statistics->lazyReferencesTime - lazyReferencesTime);
+
+    pd.sourceCharacterIndex.swap(scan.characterIndex);
+}
+
+/** Translate all the locations of the parse result of the normalized source to the original source */
+static void TranslateParseResult(const ParseResultRef<Blueprint>& out,
+    const mdp::ByteBufferOffsetTable& offsetTable,
+    const mdp::ByteBufferCharacterIndex& normalizedCharacterIndex,
+    const mdp::ByteBufferCharacterIndex& sourceCharacterIndex)
+{
+    TranslateSourceMap(out.sourceMap,
+        [&offsetTable](mdp::BytesRange& range) { range = mdp::TranslateBytesRange(range, offsetTable); });
+
+    auto translateAnnotation = [&](SourceAnnotation& annotation) {
+        if (annotation.location.empty())
+            return;
+
+        mdp::BytesRangeSet rangeSet
+            = mdp::CharactersRangeSetToBytesRangeSet(annotation.location, normalizedCharacterIndex);
+
+        for (auto& range : rangeSet) {
+            range = mdp::TranslateBytesRange(range, offsetTable);
+        }
+
+        annotation.location = mdp::BytesRangeSetToCharactersRangeSet(rangeSet, sourceCharacterIndex);
+    };
+
+    translateAnnotation(out.report.error);
+
+    for (auto& warning : out.report.warnings) {
+        translateAnnotation(warning);
     }
+}
+
+int snowcrash::parse(const mdp::ByteBuffer& source,
+    BlueprintParserOptions options,
+    const ParseResultRef<Blueprint>& out,
+    ParseStatistics* statistics)
+{
+    ReportExceptions(out.report, [&]() {
+
+        // Sanity Check
+        mdp::ByteBufferScan scan;
+        mdp::ScanByteBuffer(scan, source);
+
+        if (!(options & NormalizeSourceOption) || IsNormalized(scan)) {
+            ParseScanned(source, scan, options, out, statistics);
+            return;
+        }
+
+        // Parse the normalized source, its character index is built from the one of the original source
+        mdp::ByteBuffer normalized;
+        mdp::ByteBufferOffsetTable offsetTable;
+        mdp::ByteBufferScan normalizedScan;
+
+        mdp::NormalizeByteBuffer(normalized, offsetTable, normalizedScan.characterIndex, source, scan.characterIndex);
+
+        ParseScanned(normalized, normalizedScan, options, out, statistics);
+
+        TranslateParseResult(out, offsetTable, normalizedScan.characterIndex, scan.characterIndex);
+    });
 
     return out.report.error.code;
 }
+
+namespace
+{
+    /** Size of a chunk of the source stream read at once */
+    const std::streamsize SourceChunkSize = 1 << 16;
+
+    /**
+     *  \brief Reads a source stream in parts cut at resource group and data structure group headers
+     *
+     *  Only ATX headers following an empty line outside of fenced code blocks and HTML comments are cut at,
+     *  so the top-level markdown blocks of the parts are the same as those of the whole source.
+     */
+    class SourcePartReader
+    {
+    public:
+        explicit SourcePartReader(std::istream& source_) : source(source_) {}
+
+        /** Read the next part of the source, \returns False at the end of the source */
+        bool next(mdp::ByteBuffer& part)
+        {
+            while (true) {
+
+                size_t end = buffer.find('\n', scanned);
+
+                if (end == mdp::ByteBuffer::npos) {
+
+                    if (source) {
+                        readChunk();
+                        continue;
+                    }
+
+                    // Last line without a line break
+                    end = buffer.size();
+
+                    if (scanned == end)
+                        break;
+                }
+
+                const char* line = buffer.data() + scanned;
+                size_t length = end - scanned;
+
+                if (scanned > 0 && isPartHeader(line, length)) {
+
+                    part.assign(buffer, 0, scanned);
+                    buffer.erase(0, scanned);
+                    scanned = 0;
+
+                    return true;
+                }
+
+                scanLine(line, length);
+                scanned = std::min(end + 1, buffer.size());
+            }
+
+            if (buffer.empty())
+                return false;
+
+            part.swap(buffer);
+            buffer.clear();
+            scanned = 0;
+
+            return true;
+        }
+
+    private:
+        std::istream& source;
+
+        /** Source read but not returned yet */
+        mdp::ByteBuffer buffer;
+
+        /** Length of the lines of the buffer scanned so far */
+        size_t scanned = 0;
+
+        /** True if the last scanned line was empty */
+        bool emptyLine = true;
+
+        /** Opening fence of the fenced code block the last scanned line is in */
+        mdp::ByteBuffer fence;
+
+        /** True if the last scanned line is in an HTML comment */
+        bool comment = false;
+
+        void readChunk()
+        {
+            size_t size = buffer.size();
+
+            buffer.resize(size + SourceChunkSize);
+            source.read(&buffer[size], SourceChunkSize);
+            buffer.resize(size + source.gcount());
+        }
+
+        /** \returns Code fence the line starts with, if any */
+        static mdp::ByteBuffer codeFence(const char* line, size_t length)
+        {
+            size_t pos = 0;
+
+            while (pos < length && pos < 3 && line[pos] == ' ')
+                ++pos;
+
+            size_t begin = pos;
+
+            while (pos < length && (line[pos] == '`' || line[pos] == '~') && line[pos] == line[begin])
+                ++pos;
+
+            if (pos - begin < 3)
+                return mdp::ByteBuffer();
+
+            return mdp::ByteBuffer(line + begin, pos - begin);
+        }
+
+        void scanLine(const char* line, size_t length)
+        {
+            mdp::ByteBuffer text(line, length);
+            emptyLine = text.find_first_not_of(' ') == mdp::ByteBuffer::npos;
+
+            if (comment) {
+                comment = text.find("-->") == mdp::ByteBuffer::npos;
+                return;
+            }
+
+            mdp::ByteBuffer lineFence = codeFence(line, length);
+
+            if (fence.empty()) {
+                fence = lineFence;
+                comment = fence.empty() && text.compare(0, 4, "<!--") == 0
+                    && text.find("-->", 4) == mdp::ByteBuffer::npos;
+            } else if (lineFence.size() >= fence.size() && lineFence[0] == fence[0]
+                && text.find_first_not_of(" `~") == mdp::ByteBuffer::npos) {
+                fence.clear();
+            }
+        }
+
+        bool isPartHeader(const char* line, size_t length) const
+        {
+            if (!emptyLine || !fence.empty() || comment || length == 0 || line[0] != '#')
+                return false;
+
+            size_t pos = 0;
+
+            while (pos < length && line[pos] == '#')
+                ++pos;
+
+            if (pos > 6 || pos == length || line[pos] != ' ')
+                return false;
+
+            mdp::ByteBuffer text(line + pos, length - pos);
+            text.erase(text.find_last_not_of(" #") + 1);
+            TrimString(text);
+
+            return RegexMatch(text, GroupHeaderRegex) || RegexMatch(text, DataStructureGroupRegex);
+        }
+    };
+}
+
+/** \returns Number of characters in the indexed source */
+static size_t CharacterCount(const mdp::ByteBufferCharacterIndex& index)
+{
+    return index.empty() ? 0 : index.back() + 1;
+}
+
+/** Move all the annotation locations of the report by the offset */
+static void ShiftReport(Report& report, size_t offset)
+{
+    ShiftAnnotation(report.error, offset);
+
+    for (auto& warning : report.warnings) {
+        ShiftAnnotation(warning, offset);
+    }
+}
+
+/** Fill and resolve the named type tables from all the parts of the source */
+static void GatherNamedTypes(std::istream& source, mdp::ByteBuffer& part, SectionParserData& pd, Report& report)
+{
+    SourcePartReader parts(source);
+    Report scanReport;
+    size_t characterOffset = 0;
+
+    while (parts.next(part)) {
+
+        ReportExceptions(scanReport, [&]() {
+
+            if (!ScanSource(part, pd, scanReport))
+                return;
+
+            mdp::MarkdownParser markdownParser;
+            mdp::MarkdownNode markdownAST;
+            markdownParser.parse(part, markdownAST);
+
+            // Possible mistakes are reported while parsing the part
+            SectionProcessor<Blueprint>::scanNestedSections(
+                markdownAST.children().begin(), markdownAST.children(), pd, scanReport, true);
+        });
+
+        if (scanReport.error.code != Error::OK) {
+
+            ShiftAnnotation(scanReport.error, characterOffset);
+            report.error = scanReport.error;
+            return;
+        }
+
+        characterOffset += CharacterCount(pd.sourceCharacterIndex);
+    }
+
+    // Named types of all the parts are resolved at once, their locations are not available
+    pd.sourceCharacterIndex.clear();
+    SectionProcessor<Blueprint>::resolveNamedTypeTables(pd, report);
+
+    pd.namedTypesGathered = true;
+}
+
+int snowcrash::parse(std::istream& source, BlueprintParserOptions options, const BlueprintPartHandler& handler)
+{
+    std::istream::pos_type start = source.tellg();
+
+    // Normalized parts would be translated part by part, the source is parsed as a whole instead
+    if (start == std::istream::pos_type(-1) || (options & NormalizeSourceOption)) {
+
+        mdp::ByteBuffer buffer{ std::istreambuf_iterator<char>(source), std::istreambuf_iterator<char>() };
+        ParseResult<Blueprint> blueprint;
+
+        parse(buffer, options, blueprint);
+        handler(blueprint);
+
+        return blueprint.report.error.code;
+    }
+
+    mdp::ByteBuffer part;
+    ParseResult<Blueprint> result;
+    SectionParserData pd(options, part, result.node);
+
+    GatherNamedTypes(source, part, pd, result.report);
+
+    if (result.report.error.code != Error::OK) {
+        handler(result);
+        return result.report.error.code;
+    }
+
+    source.clear();
+    source.seekg(start);
+
+    SourcePartReader parts(source);
+    size_t characterOffset = 0;
+    bool first = true;
+
+    while (parts.next(part)) {
+
+        ReportExceptions(result.report, [&]() {
+
+            if (!ScanSource(part, pd, result.report))
+                return;
+
+            mdp::MarkdownParser markdownParser;
+            mdp::MarkdownNode markdownAST;
+            markdownParser.parse(part, markdownAST);
+
+            MarkdownNodes& nodes = markdownAST.children();
+
+            if (first) {
+                BlueprintParser::parse(nodes.begin(), nodes, pd, result);
+                return;
+            }
+
+            result.node.element = Element::CategoryElement;
+
+            if (pd.exportSourceMap()) {
+                result.sourceMap.element = result.node.element;
+            }
+
+            BlueprintParser::parseNestedSections(nodes.begin(), nodes, pd, result);
+
+            // References are resolved before the markdown nodes they point to are gone
+            SectionProcessor<Blueprint>::checkLazyReferencing(pd, result);
+        });
+
+        ShiftSourceMap(result.sourceMap, pd.sourceOffset);
+        ShiftReport(result.report, characterOffset);
+
+        handler(result);
+
+        if (result.report.error.code != Error::OK)
+            return result.report.error.code;
+
+        pd.sourceOffset += part.size();
+        characterOffset += CharacterCount(pd.sourceCharacterIndex);
+
+        result = ParseResult<Blueprint>();
+        first = false;
+    }
+
+    // Empty blueprint
+    if (first)
+        handler(result);
+
+    return Error::OK;
+}
@@ -9,9 +9,13 @@
 #ifndef SNOWCRASH_H
 #define SNOWCRASH_H
 
+#include <functional>
+#include <istream>
+
 #include "BlueprintSourcemap.h"
 #include "SourceAnnotation.h"
 #include "SectionParser.h"
+#include "ParseStatistics.h"
 
 /**
  *  API Blueprint Parser Interface
@@ -35,9 +39,41 @@ namespace snowcrash
      *  \param source       A textual source data to be parsed.
      *  \param options      Parser options. Use 0 for no additional options.
      *  \param out          Output buffer to store parsing result into.
+     *  \param statistics   Optional statistics to add the time spent in the parsing stages to.
+     *  \return Error status code. Zero represents success, non-zero a failure.
+     */
+    int parse(const mdp::ByteBuffer& source,
+        BlueprintParserOptions options,
+        const ParseResultRef<Blueprint>& out,
+        ParseStatistics* statistics = nullptr);
+
+    /**
+     *  \brief Handler of a part of a blueprint parsed from a stream.
+     *
+     *  The first part holds the blueprint metadata, name and description, every part
+     *  holds the top-level elements parsed from its source along with their source maps
+     *  and the report of parsing them. Source maps and annotation locations are relative
+     *  to the whole source. The handler may move the content out of the part.
+     */
+    typedef std::function<void(ParseResult<Blueprint>& part)> BlueprintPartHandler;
+
+    /**
+     *  \brief Parse the source stream part by part, handing each part over as soon as it is parsed.
+     *
+     *  The source is read in chunks and cut into parts at resource group and data structure
+     *  group headers, only the part being parsed is kept in memory. Named types are gathered
+     *  from the whole source before parsing the parts, so the source stream has to be seekable,
+     *  otherwise it is parsed as a single part, as well as when normalizing the source. A resource
+     *  model has to be defined before it is referenced from another part.
+     *
+     *  Parsing stops after the first part reported with an error.
+     *
+     *  \param source       A textual source data to be parsed.
+     *  \param options      Parser options. Use 0 for no additional options.
+     *  \param handler      Handler of the parsed parts.
      *  \return Error status code. Zero represents success, non-zero a failure.
      */
-    int parse(const mdp::ByteBuffer& source, BlueprintParserOptions options, const ParseResultRef<Blueprint>& out);
+    int parse(std::istream& source, BlueprintParserOptions options, const BlueprintPartHandler& handler);
 }
 
 #endif
@@ -111,7 +111,7 @@ namespace snowcrashtest
         {
 
             namedTypes.baseTable[literal] = baseType;
-            namedTypes.dependencyTable[literal] = std::set<mson::Literal>();
+            namedTypes.dependencyTable[literal] = mson::NamedTypeDependencies();
         }
     };
 
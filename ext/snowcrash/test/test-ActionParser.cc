@@ -683,3 +683,72 @@ TEST_CASE("Detect invalid reference to URI Template parameters in Action", "[act
     SourceMapHelper::check(action.report.warnings[1].location, 0, 29);
     SourceMapHelper::check(action.report.warnings[2].location, 0, 29);
 }
+
+TEST_CASE("Index action with same uri template and same http method", "[action]")
+{
+    mdp::ByteBuffer source;
+    Blueprint blueprint;
+    SectionParserData pd(0, source, blueprint);
+    Action action1, action2;
+
+    action1.method = "GET";
+    action2.method = "GET";
+
+    REQUIRE_FALSE(SectionProcessor<Action>::isActionDuplicate(pd, action2));
+    SectionProcessor<Action>::indexAction(pd, action1);
+    REQUIRE(SectionProcessor<Action>::isActionDuplicate(pd, action2));
+}
+
+TEST_CASE("Index action with same uri template and different http method", "[action]")
+{
+    mdp::ByteBuffer source;
+    Blueprint blueprint;
+    SectionParserData pd(0, source, blueprint);
+    Action action1, action2;
+
+    action1.uriTemplate = "/test";
+    action1.method = "GET";
+
+    action2.uriTemplate = "/test";
+    action2.method = "POST";
+
+    SectionProcessor<Action>::indexAction(pd, action1);
+    REQUIRE_FALSE(SectionProcessor<Action>::isActionDuplicate(pd, action2));
+}
+
+TEST_CASE("Index action with different uri template and same http method", "[action]")
+{
+    mdp::ByteBuffer source;
+    Blueprint blueprint;
+    SectionParserData pd(0, source, blueprint);
+    Action action1, action2;
+
+    action1.method = "GET";
+
+    action2.uriTemplate = "/test";
+    action2.method = "GET";
+
+    SectionProcessor<Action>::indexAction(pd, action1);
+    REQUIRE_FALSE(SectionProcessor<Action>::isActionDuplicate(pd, action2));
+}
+
+TEST_CASE("Index action relation identifiers", "[action]")
+{
+    mdp::ByteBuffer source;
+    Blueprint blueprint;
+    SectionParserData pd(0, source, blueprint);
+    Action action;
+    Relation relation;
+
+    action.method = "POST";
+    action.relation.str = "create";
+
+    SectionProcessor<Action>::indexAction(pd, action);
+    REQUIRE(SectionProcessor<Action>::isRelationDuplicate(pd, action.relation));
+
+    // Actions without a relation never collide
+    REQUIRE_FALSE(SectionProcessor<Action>::isRelationDuplicate(pd, relation));
+
+    relation.str = "delete";
+    REQUIRE_FALSE(SectionProcessor<Action>::isRelationDuplicate(pd, relation));
+}
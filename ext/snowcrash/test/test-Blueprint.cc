@@ -28,3 +28,28 @@ TEST_CASE("blueprint/init", "Blueprint initialization")
     REQUIRE(blueprint.metadata.size() == 0);
     REQUIRE(blueprint.content.elements().size() == 0);
 }
+
+TEST_CASE("blueprint/move", "Moving Blueprint elements keeps their content")
+{
+    Element resource(Element::ResourceElement);
+    resource.content.resource.name = "Resource";
+
+    Element group(Element::CategoryElement);
+    group.attributes.name = "Group";
+    group.content.elements().push_back(resource);
+
+    Blueprint blueprint;
+    blueprint.content.elements().push_back(std::move(group));
+
+    REQUIRE(blueprint.content.elements().size() == 1);
+    REQUIRE(blueprint.content.elements()[0].attributes.name == "Group");
+    REQUIRE(blueprint.content.elements()[0].content.elements().size() == 1);
+    REQUIRE(blueprint.content.elements()[0].content.elements()[0].content.resource.name == "Resource");
+
+    Blueprint copy = blueprint;
+    Element moved = std::move(blueprint.content.elements()[0]);
+
+    REQUIRE(moved.content.elements().size() == 1);
+    REQUIRE(copy.content.elements()[0].content.elements().size() == 1);
+    REQUIRE(blueprint.content.elements()[0].content.elements().empty());
+}
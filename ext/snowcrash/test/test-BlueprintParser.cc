@@ -1490,3 +1490,397 @@ TEST_CASE("Parse blueprint with random header node after resource", "[blueprint]
     REQUIRE(blueprint.report.error.code != Error::OK);
     REQUIRE(blueprint.report.warnings.size() == 1);
 }
+
+TEST_CASE("Report resource group defined twice", "[blueprint]")
+{
+    mdp::ByteBuffer source
+        = "# Group Posts\n"
+          "## /posts\n"
+          "### List [GET]\n"
+          "+ Response 204\n"
+          "\n"
+          "# Group Posts\n"
+          "## /comments\n"
+          "### List [GET]\n"
+          "+ Response 204\n";
+
+    ParseResult<Blueprint> blueprint;
+    SectionParserHelper<Blueprint, BlueprintParser>::parse(
+        source, BlueprintSectionType, blueprint, ExportSourcemapOption, Models(), &blueprint);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(blueprint.report.warnings.size() == 1);
+    REQUIRE(blueprint.report.warnings[0].code == DuplicateWarning);
+    REQUIRE(blueprint.report.warnings[0].message == "group 'Posts' is already defined");
+
+    REQUIRE(blueprint.node.content.elements().size() == 2);
+}
+
+TEST_CASE("Report named type defined in two data structures sections", "[blueprint]")
+{
+    mdp::ByteBuffer source
+        = "# Data Structures\n"
+          "## Coupon\n"
+          "- name\n"
+          "\n"
+          "# Data Structures\n"
+          "## Coupon\n"
+          "- code\n";
+
+    ParseResult<Blueprint> blueprint;
+    SectionParserHelper<Blueprint, BlueprintParser>::parse(
+        source, BlueprintSectionType, blueprint, ExportSourcemapOption, Models(), &blueprint);
+
+    REQUIRE(blueprint.report.warnings.size() == 1);
+    REQUIRE(blueprint.report.warnings[0].code == DuplicateWarning);
+    REQUIRE(blueprint.report.warnings[0].message == "named type with name 'Coupon' already exists");
+
+    REQUIRE(blueprint.node.content.elements().size() == 2);
+    REQUIRE(blueprint.node.content.elements().at(0).content.elements().size() == 1);
+    REQUIRE(blueprint.node.content.elements().at(1).content.elements().empty());
+}
+
+TEST_CASE("Report resource defined in two resource groups", "[blueprint]")
+{
+    mdp::ByteBuffer source
+        = "# Group Posts\n"
+          "## /posts\n"
+          "### List [GET]\n"
+          "+ Response 204\n"
+          "\n"
+          "# Group Comments\n"
+          "## /posts\n"
+          "### Create [POST]\n"
+          "+ Response 204\n";
+
+    ParseResult<Blueprint> blueprint;
+    SectionParserHelper<Blueprint, BlueprintParser>::parse(
+        source, BlueprintSectionType, blueprint, ExportSourcemapOption, Models(), &blueprint);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(blueprint.report.warnings.size() == 1);
+    REQUIRE(blueprint.report.warnings[0].code == DuplicateWarning);
+    REQUIRE(blueprint.report.warnings[0].message == "the resource '/posts' is already defined");
+}
+
+TEST_CASE("Do not report actions and relations repeated in another resource", "[blueprint]")
+{
+    mdp::ByteBuffer source
+        = "# Group Posts\n"
+          "## /posts\n"
+          "### Create [POST]\n"
+          "+ Relation: create\n"
+          "+ Response 204\n"
+          "\n"
+          "# Group Comments\n"
+          "## /comments\n"
+          "### Create [POST]\n"
+          "+ Relation: create\n"
+          "+ Response 204\n";
+
+    ParseResult<Blueprint> blueprint;
+    SectionParserHelper<Blueprint, BlueprintParser>::parse(
+        source, BlueprintSectionType, blueprint, ExportSourcemapOption, Models(), &blueprint);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(blueprint.report.warnings.empty());
+}
+
+TEST_CASE("Resolve forward model references at their locations", "[blueprint][model]")
+{
+    mdp::ByteBuffer source
+        = "# Group Posts\n"
+          "## /posts\n"
+          "### List [GET]\n"
+          "+ Response 200\n"
+          "\n"
+          "    [Post][]\n"
+          "\n"
+          "### Create [POST]\n"
+          "+ Request\n"
+          "\n"
+          "    [Post][]\n"
+          "\n"
+          "+ Response 201\n"
+          "\n"
+          "    [Post][]\n"
+          "\n"
+          "## Post [/posts/{id}]\n"
+          "+ Model (text/plain)\n"
+          "\n"
+          "        post\n";
+
+    ParseResult<Blueprint> blueprint;
+    SectionParserHelper<Blueprint, BlueprintParser>::parse(
+        source, BlueprintSectionType, blueprint, ExportSourcemapOption, Models(), &blueprint);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    REQUIRE(blueprint.node.content.elements().size() == 1);
+    REQUIRE(blueprint.node.content.elements()[0].content.elements().size() == 2);
+
+    const Resource& resource = blueprint.node.content.elements()[0].content.elements()[0].content.resource;
+    REQUIRE(resource.actions.size() == 2);
+
+    const Payload& listResponse = resource.actions[0].examples[0].responses[0];
+    REQUIRE(listResponse.reference.meta.state == Reference::StateResolved);
+    REQUIRE(listResponse.body == "post\n");
+
+    const TransactionExample& create = resource.actions[1].examples[0];
+    REQUIRE(create.requests[0].reference.meta.state == Reference::StateResolved);
+    REQUIRE(create.requests[0].body == "post\n");
+    REQUIRE(create.responses[0].reference.meta.state == Reference::StateResolved);
+    REQUIRE(create.responses[0].body == "post\n");
+
+    const SourceMap<TransactionExample>& createSourceMap = blueprint.sourceMap.content.elements()
+                                                               .collection[0]
+                                                               .content.elements()
+                                                               .collection[0]
+                                                               .content.resource.actions.collection[1]
+                                                               .examples.collection[0];
+    REQUIRE(!createSourceMap.requests.collection[0].body.sourceMap.empty());
+    REQUIRE(!createSourceMap.responses.collection[0].body.sourceMap.empty());
+}
+
+TEST_CASE("Report undefined forward model reference", "[blueprint][model]")
+{
+    mdp::ByteBuffer source
+        = "## /b\n"
+          "### List [GET]\n"
+          "+ Response 204\n"
+          "\n"
+          "## /a\n"
+          "### List [GET]\n"
+          "+ Response 200\n"
+          "\n"
+          "    [Missing][]\n";
+
+    ParseResult<Blueprint> blueprint;
+    SectionParserHelper<Blueprint, BlueprintParser>::parse(
+        source, BlueprintSectionType, blueprint, 0, Models(), &blueprint);
+
+    REQUIRE(blueprint.report.error.code == ModelError);
+    REQUIRE(blueprint.report.error.message == "Undefined resource model Missing");
+    REQUIRE(blueprint.report.error.location[0].location > source.find("## /a"));
+
+    // Resources out of any group are elements of the blueprint
+    REQUIRE(blueprint.node.content.elements().size() == 2);
+
+    const Resource& resource = blueprint.node.content.elements()[1].content.resource;
+    REQUIRE(resource.uriTemplate == "/a");
+    REQUIRE(resource.actions[0].examples[0].responses[0].reference.meta.state == Reference::StateUnresolved);
+}
+
+/** Parse the nested sections of a source split into shards starting at the given headers */
+static void parseShards(
+    const mdp::ByteBuffer& source, const std::vector<mdp::ByteBuffer>& headers, ParseResult<Blueprint>& blueprint)
+{
+    typedef SectionProcessor<Blueprint>::NestedSectionShard Shard;
+
+    mdp::MarkdownParser markdownParser;
+    mdp::MarkdownNode markdownAST;
+    markdownParser.parse(source, markdownAST);
+
+    const mdp::MarkdownNodes& nodes = markdownAST.children();
+    REQUIRE(!nodes.empty());
+
+    SectionParserData pd(ExportSourcemapOption | ParallelParseOption, source, blueprint.node);
+    mdp::BuildCharacterIndex(pd.sourceCharacterIndex, source);
+    pd.sectionsContext.push_back(BlueprintSectionType);
+
+    // As when parsing the blueprint, the named types are gathered first
+    SectionProcessor<Blueprint>::preprocessNestedSections(
+        nodes.begin(), nodes, pd, ParseResultRef<Blueprint>(blueprint));
+
+    SectionProcessor<Blueprint>::NestedSectionShards shards;
+    shards.emplace_back(new Shard(pd, nodes.begin()));
+
+    for (const auto& header : headers) {
+        mdp::MarkdownNodeIterator boundary
+            = std::find_if(shards.back()->begin + 1, nodes.end(), [&](const mdp::MarkdownNode& node) {
+                  return node.type == mdp::HeaderMarkdownNodeType && node.text == header;
+              });
+
+        REQUIRE(boundary != nodes.end());
+
+        shards.back()->end = boundary;
+        shards.emplace_back(new Shard(pd, boundary));
+    }
+
+    shards.back()->end = nodes.end();
+
+    REQUIRE(SectionProcessor<Blueprint>::parseShards(shards, nodes, pd, ParseResultRef<Blueprint>(blueprint))
+        == nodes.end());
+
+    // As when finalizing the blueprint
+    SectionProcessor<Blueprint>::checkLazyReferencing(pd, ParseResultRef<Blueprint>(blueprint));
+}
+
+/** Require the same annotation */
+static void requireSameAnnotation(const SourceAnnotation& annotation, const SourceAnnotation& expected)
+{
+    REQUIRE(annotation.code == expected.code);
+    REQUIRE(annotation.message == expected.message);
+    REQUIRE(annotation.location.size() == expected.location.size());
+
+    for (size_t i = 0; i < expected.location.size(); ++i) {
+        REQUIRE(annotation.location[i].location == expected.location[i].location);
+        REQUIRE(annotation.location[i].length == expected.location[i].length);
+    }
+}
+
+/** Parse the source split into shards as %parseShards does, requiring the result of parsing it sequentially */
+static void parseShardsAsSequentially(
+    const mdp::ByteBuffer& source, const std::vector<mdp::ByteBuffer>& headers, ParseResult<Blueprint>& blueprint)
+{
+    ParseResult<Blueprint> sequential;
+    parseShards(source, {}, sequential);
+
+    parseShards(source, headers, blueprint);
+
+    requireSameAnnotation(blueprint.report.error, sequential.report.error);
+
+    REQUIRE(blueprint.report.warnings.size() == sequential.report.warnings.size());
+    for (size_t i = 0; i < sequential.report.warnings.size(); ++i) {
+        requireSameAnnotation(blueprint.report.warnings[i], sequential.report.warnings[i]);
+    }
+
+    const Elements& elements = blueprint.node.content.elements();
+    const Elements& expected = sequential.node.content.elements();
+
+    REQUIRE(elements.size() == expected.size());
+    REQUIRE(blueprint.sourceMap.content.elements().collection.size()
+        == sequential.sourceMap.content.elements().collection.size());
+
+    for (size_t i = 0; i < expected.size(); ++i) {
+        REQUIRE(elements[i].element == expected[i].element);
+        REQUIRE(elements[i].attributes.name == expected[i].attributes.name);
+        REQUIRE(elements[i].content.elements().size() == expected[i].content.elements().size());
+    }
+}
+
+TEST_CASE("Parse shard going past its boundary sequentially", "[blueprint][parallel]")
+{
+    mdp::ByteBuffer source
+        = "# Group A\n"
+          "## /a\n"
+          "### List [GET]\n"
+          "+ Response 204\n"
+          "\n"
+          "# Group B\n"
+          "## /b\n"
+          "### List [GET]\n"
+          "+ Response 204\n";
+
+    // The first shard ends in the middle of 'Group A'
+    ParseResult<Blueprint> blueprint;
+    parseShardsAsSequentially(source, { "/a", "Group B" }, blueprint);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(blueprint.report.warnings.empty());
+
+    const Elements& elements = blueprint.node.content.elements();
+    REQUIRE(elements.size() == 2);
+    REQUIRE(blueprint.sourceMap.content.elements().collection.size() == 2);
+
+    REQUIRE(elements[0].attributes.name == "A");
+    REQUIRE(elements[0].content.elements().size() == 1);
+    REQUIRE(elements[0].content.elements()[0].content.resource.uriTemplate == "/a");
+
+    REQUIRE(elements[1].attributes.name == "B");
+    REQUIRE(elements[1].content.elements().size() == 1);
+    REQUIRE(elements[1].content.elements()[0].content.resource.uriTemplate == "/b");
+}
+
+TEST_CASE("Report the errors of shards as parsed sequentially", "[blueprint][parallel]")
+{
+    mdp::ByteBuffer source
+        = "# Group A\n"
+          "## /a\n"
+          "+ Model (text/plain)\n\n"
+          "        a\n"
+          "\n"
+          "# Group B\n"
+          "## X [/x1]\n"
+          "+ Model (text/plain)\n\n"
+          "        x1\n"
+          "\n"
+          "## X [/x2]\n"
+          "+ Model (text/plain)\n\n"
+          "        x2\n";
+
+    ParseResult<Blueprint> blueprint;
+    parseShardsAsSequentially(source, { "Group B" }, blueprint);
+
+    // The error of 'Group B' replaces the one of 'Group A'
+    REQUIRE(blueprint.report.error.code != Error::OK);
+    REQUIRE(blueprint.report.error.location[0].location > source.find("# Group B"));
+
+    REQUIRE(blueprint.node.content.elements().size() == 2);
+}
+
+TEST_CASE("Report the named type dependency errors of shards as parsed sequentially", "[blueprint][parallel]")
+{
+    mdp::ByteBuffer source
+        = "# Data Structures\n"
+          "\n"
+          "## A\n"
+          "- id: a\n"
+          "- Include B\n"
+          "\n"
+          "# Data Structures\n"
+          "\n"
+          "## B\n"
+          "- id: b\n"
+          "- Include A\n"
+          "\n"
+          "# Group C\n"
+          "## /c\n"
+          "### List [GET]\n"
+          "+ Response 204\n";
+
+    ParseResult<Blueprint> blueprint;
+    parseShardsAsSequentially(source, { "Data Structures", "Group C" }, blueprint);
+
+    // The second data structure including the first one is circular
+    REQUIRE(blueprint.report.error.code == MSONError);
+
+    REQUIRE(blueprint.node.content.elements().size() == 3);
+}
+
+TEST_CASE("Resolve forward model references of shards", "[blueprint][parallel][model]")
+{
+    mdp::ByteBuffer source
+        = "# Group A\n"
+          "## /a\n"
+          "### List [GET]\n"
+          "+ Response 200\n"
+          "\n"
+          "    [B][]\n"
+          "\n"
+          "# Group B\n"
+          "## /c\n"
+          "### List [GET]\n"
+          "+ Response 200\n"
+          "\n"
+          "    [B][]\n"
+          "\n"
+          "## B [/b]\n"
+          "+ Model (text/plain)\n"
+          "\n"
+          "        b\n";
+
+    ParseResult<Blueprint> blueprint;
+    parseShardsAsSequentially(source, { "Group B" }, blueprint);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+
+    const Elements& elements = blueprint.node.content.elements();
+    REQUIRE(elements.size() == 2);
+
+    for (const auto& element : elements) {
+        const Payload& response = element.content.elements()[0].content.resource.actions[0].examples[0].responses[0];
+        REQUIRE(response.reference.meta.state == Reference::StateResolved);
+        REQUIRE(response.body == "b\n");
+    }
+}
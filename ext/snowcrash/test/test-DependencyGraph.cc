@@ -0,0 +1,82 @@
+//
+//  test-DependencyGraph.cc
+//  snowcrash
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#include "snowcrashtest.h"
+#include "DependencyGraph.h"
+
+using namespace snowcrash;
+
+TEST_CASE("Resolve dependency graph without cycles", "[dependency_graph]")
+{
+    // 0 -> 1 -> 2, 3 -> 2
+    DependencyGraph graph(4);
+    graph.addDependency(0, 1);
+    graph.addDependency(1, 2);
+    graph.addDependency(3, 2);
+    graph.resolve();
+
+    REQUIRE(graph.components().size() == 4);
+    REQUIRE(graph.component(2) < graph.component(1));
+    REQUIRE(graph.component(1) < graph.component(0));
+
+    REQUIRE(graph.dependsOn(0, 2));
+    REQUIRE_FALSE(graph.dependsOn(2, 0));
+    REQUIRE_FALSE(graph.dependsOn(3, 1));
+
+    REQUIRE_FALSE(graph.isCyclic(0));
+    REQUIRE(graph.transitiveDependencies(0) == DependencyGraph::Ids({ 1, 2 }));
+    REQUIRE(graph.transitiveDependencies(2).empty());
+}
+
+TEST_CASE("Resolve dependency graph with cycles", "[dependency_graph]")
+{
+    // 0 -> 1 -> 2 -> 0, 2 -> 3, 4 -> 4, 5 -> 0
+    DependencyGraph graph;
+    graph.addDependency(0, 1);
+    graph.addDependency(1, 2);
+    graph.addDependency(2, 0);
+    graph.addDependency(2, 3);
+    graph.addDependency(4, 4);
+    graph.addDependency(5, 0);
+    graph.resolve();
+
+    REQUIRE(graph.size() == 6);
+    REQUIRE(graph.components().size() == 4);
+
+    REQUIRE(graph.component(0) == graph.component(1));
+    REQUIRE(graph.component(1) == graph.component(2));
+    REQUIRE(graph.components()[graph.component(0)] == DependencyGraph::Ids({ 0, 1, 2 }));
+
+    REQUIRE(graph.isCyclic(1));
+    REQUIRE(graph.isCyclic(4));
+    REQUIRE_FALSE(graph.isCyclic(3));
+    REQUIRE_FALSE(graph.isCyclic(5));
+
+    REQUIRE(graph.transitiveDependencies(1) == DependencyGraph::Ids({ 0, 1, 2, 3 }));
+    REQUIRE(graph.transitiveDependencies(4) == DependencyGraph::Ids({ 4 }));
+    REQUIRE(graph.transitiveDependencies(5) == DependencyGraph::Ids({ 0, 1, 2, 3 }));
+}
+
+TEST_CASE("Resolve components of dependency graph without closure", "[dependency_graph]")
+{
+    // 0 -> 1 -> 0, 1 -> 2, 3 -> 3
+    DependencyGraph graph(4);
+    graph.addDependency(0, 1);
+    graph.addDependency(1, 0);
+    graph.addDependency(1, 2);
+    graph.addDependency(3, 3);
+    graph.resolveComponents();
+
+    REQUIRE(graph.components().size() == 3);
+    REQUIRE(graph.component(0) == graph.component(1));
+    REQUIRE(graph.component(2) < graph.component(0));
+
+    REQUIRE(graph.isCyclic(0));
+    REQUIRE(graph.isCyclic(1));
+    REQUIRE_FALSE(graph.isCyclic(2));
+    REQUIRE(graph.isCyclic(3));
+}
@@ -436,3 +436,38 @@ TEST_CASE("Too eager complete action processing", "[resource_group][regression][
 
     SourceMapHelper::check(resourceGroup.sourceMap.content.elements().collection[0].content.copy.sourceMap, 11, 28);
 }
+
+TEST_CASE("Do not report actions and relations repeated in another resource of the group", "[resource_group]")
+{
+    mdp::ByteBuffer source
+        = "# Group\n"
+          "## /r1\n"
+          "### Remove [DELETE]\n"
+          "+ Relation: remove\n"
+          "+ Response 204\n"
+          "\n"
+          "## /r2\n"
+          "### Remove [DELETE]\n"
+          "+ Relation: remove\n"
+          "+ Response 204\n"
+          "\n"
+          "### Purge [DELETE]\n"
+          "+ Relation: remove\n"
+          "+ Response 204\n";
+
+    ParseResult<ResourceGroup> resourceGroup;
+    SectionParserHelper<ResourceGroup, ResourceGroupParser>::parse(
+        source, ResourceGroupSectionType, resourceGroup, ExportSourcemapOption);
+
+    REQUIRE(resourceGroup.report.error.code == Error::OK);
+    REQUIRE(resourceGroup.report.warnings.size() == 2);
+    REQUIRE(resourceGroup.report.warnings[0].code == DuplicateWarning);
+    REQUIRE(resourceGroup.report.warnings[0].message
+        == "action with method 'DELETE' already defined for resource '/r2'");
+    REQUIRE(resourceGroup.report.warnings[1].code == DuplicateWarning);
+    REQUIRE(resourceGroup.report.warnings[1].message
+        == "relation identifier 'remove' already defined for resource '/r2'");
+
+    REQUIRE(resourceGroup.node.content.elements().size() == 2);
+    REQUIRE(resourceGroup.node.content.elements().at(1).content.resource.actions.size() == 2);
+}
@@ -1096,3 +1096,30 @@ TEST_CASE("Detect invalid reference to resource URI Template parameters", "[reso
     SourceMapHelper::check(resource.report.warnings[1].location, 27, 68);
     SourceMapHelper::check(resource.report.warnings[2].location, 27, 68);
 }
+
+TEST_CASE("Actions with the same method are unique when their URI templates differ", "[resource]")
+{
+    mdp::ByteBuffer source
+        = "## Users [/users]\n"
+          "\n"
+          "### Retrieve [GET /users/{id}]\n"
+          "+ Parameters\n"
+          "    + id (string)\n"
+          "+ Response 204\n"
+          "\n"
+          "### List [GET]\n"
+          "+ Response 204\n"
+          "\n"
+          "### List again [GET]\n"
+          "+ Response 204";
+
+    ParseResult<Resource> resource;
+    SectionParserHelper<Resource, ResourceParser>::parse(source, ResourceSectionType, resource, ExportSourcemapOption);
+
+    REQUIRE(resource.report.error.code == Error::OK);
+    REQUIRE(resource.report.warnings.size() == 1);
+    REQUIRE(resource.report.warnings[0].code == DuplicateWarning);
+    REQUIRE(resource.report.warnings[0].message == "action with method 'GET' already defined for resource '/users'");
+
+    REQUIRE(resource.node.actions.size() == 3);
+}
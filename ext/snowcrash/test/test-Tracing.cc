@@ -0,0 +1,72 @@
+//
+//  test-Tracing.cc
+//  snowcrash
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#include <sstream>
+#include "snowcrashtest.h"
+#include "Tracing.h"
+
+using namespace snowcrash;
+
+TEST_CASE("Spans are not recorded while tracing is disabled", "[tracing]")
+{
+    trace::enable(false);
+    trace::clear();
+
+    {
+        TRACE_SPAN("Disabled");
+    }
+
+    std::stringstream out;
+    REQUIRE(trace::writeChromeTrace(out) == 0);
+    REQUIRE(out.str().find("Disabled") == std::string::npos);
+}
+
+#ifndef DISABLE_TRACING
+TEST_CASE("Write recorded spans in Chrome trace event format", "[tracing]")
+{
+    trace::enable();
+    trace::clear();
+
+    {
+        TRACE_SPAN("Outer");
+        TRACE_SPAN_DETAIL("Inner", std::string("Resource \"Notes\"\nDescription"));
+    }
+
+    trace::enable(false);
+
+    std::stringstream out;
+    REQUIRE(trace::writeChromeTrace(out) == 2);
+
+    const std::string trace = out.str();
+    REQUIRE(trace.find("{\"traceEvents\":[") == 0);
+    REQUIRE(trace.find("\"name\":\"Outer\"") != std::string::npos);
+    REQUIRE(trace.find("\"name\":\"Inner\"") != std::string::npos);
+    REQUIRE(trace.find("\"ph\":\"X\"") != std::string::npos);
+    REQUIRE(trace.find("\"args\":{\"detail\":\"Resource \\\"Notes\\\"\"}") != std::string::npos);
+    REQUIRE(trace.find("Description") == std::string::npos);
+
+    trace::clear();
+}
+
+TEST_CASE("Truncate long span details", "[tracing]")
+{
+    trace::enable();
+    trace::clear();
+
+    {
+        TRACE_SPAN_DETAIL("Long", std::string(2 * trace::DetailSize, 'a'));
+    }
+
+    trace::enable(false);
+
+    std::stringstream out;
+    REQUIRE(trace::writeChromeTrace(out) == 1);
+    REQUIRE(out.str().find("\"" + std::string(trace::DetailSize, 'a') + "\"") != std::string::npos);
+
+    trace::clear();
+}
+#endif
@@ -85,6 +85,47 @@ TEST_CASE("Parse blueprint with unsupported characters", "[parser]")
     SourceMapHelper::check(blueprint2.report.error.location, 4, 1);
 }
 
+TEST_CASE("Parse blueprint with normalized tabs and line endings", "[parser][normalize]")
+{
+    mdp::ByteBuffer source = "# API\r\n\r\n# GET /1\r\n";
+    mdp::ByteBuffer normalized = "# API\n\n# GET /1\n";
+
+    ParseResult<Blueprint> blueprint;
+    parse(source, ExportSourcemapOption | NormalizeSourceOption, blueprint);
+
+    ParseResult<Blueprint> expected;
+    parse(normalized, ExportSourcemapOption, expected);
+
+    REQUIRE(blueprint.report.error.code == Error::OK);
+    REQUIRE(blueprint.report.warnings.size() == 1);
+    REQUIRE(expected.report.warnings.size() == 1);
+    REQUIRE(blueprint.node.name == "API");
+
+    // Locations follow the two carriage returns preceding the action
+    REQUIRE(blueprint.report.warnings[0].location.size() == 1);
+    REQUIRE(blueprint.report.warnings[0].location[0].location == expected.report.warnings[0].location[0].location + 2);
+
+    REQUIRE(blueprint.sourceMap.content.elements().collection.size() == 1);
+
+    const SourceMap<Action>& actionSM
+        = blueprint.sourceMap.content.elements().collection[0].content.resource.actions.collection[0];
+    const SourceMap<Action>& expectedSM
+        = expected.sourceMap.content.elements().collection[0].content.resource.actions.collection[0];
+
+    REQUIRE(actionSM.method.sourceMap.size() == 1);
+    REQUIRE(actionSM.method.sourceMap[0].location == expectedSM.method.sourceMap[0].location + 2);
+    REQUIRE(mdp::MapBytesRangeSet(actionSM.method.sourceMap, source).find("# GET /1") == 0);
+
+    SECTION("Tabs are expanded")
+    {
+        ParseResult<Blueprint> tabbed;
+        parse("# API\n\n\tDescription\n", NormalizeSourceOption, tabbed);
+
+        REQUIRE(tabbed.report.error.code == Error::OK);
+        REQUIRE(tabbed.node.description == "    Description\n");
+    }
+}
+
 TEST_CASE("Do not report duplicate response when media type differs", "[method][14]")
 {
     mdp::ByteBuffer source
@@ -767,3 +808,160 @@ TEST_CASE("Parse blueprint with mismatched adapter blocks", "[blueprint]")
     REQUIRE(blueprint.report.warnings.empty());
     SourceMapHelper::check(blueprint.report.error.location, 42, 24);
 }
+
+TEST_CASE("Parallel parsing matches sequential parsing", "[parser][parallel]")
+{
+    mdp::ByteBuffer source
+        = "# API\n\n"
+          "# Group A\n\n"
+          "## Note [/notes/{id}]\n\n"
+          "+ Model (text/plain)\n\n"
+          "        note\n\n"
+          "### Retrieve [GET]\n\n"
+          "+ Response 200\n\n"
+          "    [Note][]\n\n"
+          "# Data Structures\n\n"
+          "## User (object)\n\n"
+          "+ name: Andrew\n\n"
+          "# Group B\n\n"
+          "## Notes [/notes/{id}]\n\n"
+          "### List [GET]\n\n"
+          "+ Response 200\n\n"
+          "    [Note][]\n\n"
+          "# Group A\n\n"
+          "## Users [/users]\n\n"
+          "### List [GET]\n\n"
+          "+ Response 200 (application/json)\n\n"
+          "    + Attributes (array[User])\n";
+
+    ParseResult<Blueprint> sequential;
+    parse(source, ExportSourcemapOption, sequential);
+
+    ParseResult<Blueprint> parallel;
+    parse(source, ExportSourcemapOption | ParallelParseOption, parallel);
+
+    REQUIRE(parallel.report.error.code == sequential.report.error.code);
+    REQUIRE(parallel.report.warnings.size() == sequential.report.warnings.size());
+    REQUIRE(!parallel.report.warnings.empty());
+
+    for (size_t i = 0; i < sequential.report.warnings.size(); ++i) {
+        REQUIRE(parallel.report.warnings[i].code == sequential.report.warnings[i].code);
+        REQUIRE(parallel.report.warnings[i].message == sequential.report.warnings[i].message);
+    }
+
+    const Elements& elements = parallel.node.content.elements();
+    REQUIRE(elements.size() == sequential.node.content.elements().size());
+    REQUIRE(elements.size() == 4);
+    REQUIRE(parallel.sourceMap.content.elements().collection.size() == 4);
+
+    for (size_t i = 0; i < elements.size(); ++i) {
+        const Element& expected = sequential.node.content.elements()[i];
+
+        REQUIRE(elements[i].element == expected.element);
+        REQUIRE(elements[i].attributes.name == expected.attributes.name);
+        REQUIRE(elements[i].content.elements().size() == expected.content.elements().size());
+    }
+
+    const Resource& notes = elements[2].content.elements()[0].content.resource;
+    REQUIRE(notes.actions[0].examples[0].responses[0].reference.meta.state == Reference::StateResolved);
+    REQUIRE(!notes.actions[0].examples[0].responses[0].body.empty());
+}
+
+TEST_CASE("Parsing a stream in parts matches parsing the whole source", "[parser][stream]")
+{
+    mdp::ByteBuffer source
+        = "# API\n\n"
+          "Description\n\n"
+          "# Group A\n\n"
+          "## Note [/notes/{id}]\n\n"
+          "+ Model (text/plain)\n\n"
+          "        note\n\n"
+          "### Retrieve [GET]\n\n"
+          "+ Response 200 (application/json)\n\n"
+          "    + Attributes (User)\n\n"
+          "# Group B\n\n"
+          "```\n\n"
+          "# Group Fenced\n"
+          "```\n\n"
+          "## Notes [/notes/{id}]\n\n"
+          "### List [GET]\n\n"
+          "+ Response 200\n\n"
+          "    [Note][]\n\n"
+          "# Data Structures\n\n"
+          "## User (object)\n\n"
+          "+ name: Andrew\n";
+
+    ParseResult<Blueprint> whole;
+    parse(source, ExportSourcemapOption, whole);
+
+    std::vector<ParseResult<Blueprint> > parts;
+    std::istringstream stream(source);
+
+    int code = parse(stream, ExportSourcemapOption, [&parts](ParseResult<Blueprint>& part) {
+        parts.push_back(std::move(part));
+    });
+
+    REQUIRE(code == whole.report.error.code);
+    REQUIRE(parts.size() == 4);
+    REQUIRE(parts[0].node.name == "API");
+    REQUIRE(parts[0].node.description == whole.node.description);
+
+    Elements elements;
+    Collection<SourceMap<Element> >::type elementsSourceMap;
+    Warnings warnings;
+
+    for (auto& part : parts) {
+        REQUIRE(part.report.error.code == Error::OK);
+
+        for (auto& element : part.node.content.elements()) {
+            elements.push_back(element);
+        }
+
+        for (auto& sourceMap : part.sourceMap.content.elements().collection) {
+            elementsSourceMap.push_back(sourceMap);
+        }
+
+        warnings.insert(warnings.end(), part.report.warnings.begin(), part.report.warnings.end());
+    }
+
+    REQUIRE(elements.size() == whole.node.content.elements().size());
+    REQUIRE(elements.size() == 3);
+    REQUIRE(elementsSourceMap.size() == 3);
+
+    for (size_t i = 0; i < elements.size(); ++i) {
+        const Element& expected = whole.node.content.elements()[i];
+        const SourceMap<Element>& expectedSourceMap = whole.sourceMap.content.elements().collection[i];
+
+        REQUIRE(elements[i].element == expected.element);
+        REQUIRE(elements[i].attributes.name == expected.attributes.name);
+        REQUIRE(elements[i].content.elements().size() == expected.content.elements().size());
+
+        REQUIRE(elementsSourceMap[i].sourceMap.size() == expectedSourceMap.sourceMap.size());
+        REQUIRE(elementsSourceMap[i].sourceMap[0].location == expectedSourceMap.sourceMap[0].location);
+        REQUIRE(elementsSourceMap[i].sourceMap[0].length == expectedSourceMap.sourceMap[0].length);
+    }
+
+    REQUIRE(warnings.size() == whole.report.warnings.size());
+
+    for (size_t i = 0; i < warnings.size(); ++i) {
+        REQUIRE(warnings[i].code == whole.report.warnings[i].code);
+        REQUIRE(warnings[i].location[0].location == whole.report.warnings[i].location[0].location);
+    }
+
+    // Model referenced from another part
+    const Payload& response = elements[1].content.elements()[0].content.resource.actions[0].examples[0].responses[0];
+    const SourceMap<Payload>& responseSourceMap
+        = elementsSourceMap[1].content.elements().collection[0].content.resource.actions.collection[0]
+              .examples.collection[0]
+              .responses.collection[0];
+
+    const SourceMap<Payload>& expectedSourceMap
+        = whole.sourceMap.content.elements().collection[1].content.elements().collection[0]
+              .content.resource.actions.collection[0]
+              .examples.collection[0]
+              .responses.collection[0];
+
+    REQUIRE(response.reference.meta.state == Reference::StateResolved);
+    REQUIRE(response.body == "note\n");
+    REQUIRE(responseSourceMap.body.sourceMap[0].location == expectedSourceMap.body.sourceMap[0].location);
+}
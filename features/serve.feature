@@ -0,0 +1,28 @@
+Feature: Serve parse requests
+
+  Scenario: Answer length-prefixed parse requests read from stdin
+
+    When I run `drafter --serve` interactively
+    When I pipe in the file "requests.txt"
+    Then the output should contain:
+    """
+    "element": "parseResult"
+    """
+    And the output should contain:
+    """
+    unexpected header block, expected a group, resource or an action definition
+    """
+
+  Scenario: Answer requests longer than the maximum with an error
+
+    When I run `drafter --serve --max-request-size 100` interactively
+    When I pipe in the file "requests.txt"
+    Then the output should contain:
+    """
+    -1 54
+    request of 1764 bytes exceeds the maximum of 100 bytes
+    """
+    And the output should contain:
+    """
+    unexpected header block, expected a group, resource or an action definition
+    """
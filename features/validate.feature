@@ -44,3 +44,17 @@ Feature: Validate a blueprint
     OK.
     warning: (5)  unexpected header block, expected a group, resource or an action definition, e.g. '# Group <name>', '# <resource name> [<URI>]' or '# <HTTP method> <URI>'; line 4, column 1 - line 4, column 29
     """
+
+  Scenario: Validate more blueprint files concurrently
+
+    When I run `drafter --validate --jobs 2 blueprint.apib invalid_blueprint.apib`
+    Then the output should contain:
+    """
+    blueprint.apib:
+    OK.
+    invalid_blueprint.apib:
+    OK.
+    warning: (5)  unexpected header block, expected a group, resource or an action definition, e.g. '# Group <name>', '# <resource name> [<URI>]' or '# <HTTP method> <URI>' :24:29
+
+    2 files, 0 failed
+    """
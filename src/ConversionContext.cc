@@ -7,33 +7,95 @@
 //
 
 #include "ConversionContext.h"
+#include "refract/Hash.h"
+
+#include <cstdint>
+#include <cstring>
 
 namespace drafter
 {
 
-    void ConversionContext::warn(const snowcrash::Warning& warning)
+    namespace
     {
-        for (auto& item : warnings) {
-            bool equalSourceMap = true;
+        std::size_t hashWarning(
+            const char* message, const std::string& detail, int code, const mdp::CharactersRangeSet& location)
+        {
+            // FNV-1a of the message, without copying it into a std::string
+            std::uint64_t messageHash = 14695981039346656037ull;
+
+            for (const char* c = message; *c; ++c) {
+                messageHash ^= static_cast<unsigned char>(*c);
+                messageHash *= 1099511628211ull;
+            }
+
+            std::size_t seed = static_cast<std::size_t>(messageHash) ^ static_cast<std::size_t>(code);
+            seed = refract::detail::hash_combine(seed, std::hash<std::string>{}(detail));
 
-            // Compare sourcemap
-            if (item.location.size() == warning.location.size()) {
-                for (size_t i = 0; i < item.location.size(); i++) {
-                    if (item.location.at(i).length != warning.location.at(i).length
-                        || item.location.at(i).location != warning.location.at(i).location) {
+            for (const auto& range : location) {
+                seed = refract::detail::hash_combine(seed, range.location);
+                seed = refract::detail::hash_combine(seed, range.length);
+            }
+
+            return seed;
+        }
 
-                        equalSourceMap = false;
-                    }
+        bool equalWarning(const ConversionWarning& warning,
+            const char* message,
+            const std::string& detail,
+            int code,
+            const mdp::CharactersRangeSet& location)
+        {
+            if (warning.code != code || warning.location.size() != location.size()
+                || (warning.message != message && std::strcmp(warning.message, message) != 0)
+                || warning.detail != detail) {
+                return false;
+            }
+
+            for (size_t i = 0; i < location.size(); i++) {
+                if (warning.location[i].length != location[i].length
+                    || warning.location[i].location != location[i].location) {
+
+                    return false;
                 }
-            } else {
-                equalSourceMap = false;
             }
 
-            if (equalSourceMap && item.code == warning.code && item.message == warning.message) {
+            return true;
+        }
+    }
+
+    std::string ConversionWarning::text() const
+    {
+        return std::string(message).append(detail);
+    }
+
+    void ConversionContext::warn(
+        const char* message, int code, const mdp::CharactersRangeSet& location, std::string detail)
+    {
+        const std::size_t hash = hashWarning(message, detail, code, location);
+        const auto candidates = warningIndex.equal_range(hash);
+
+        for (auto it = candidates.first; it != candidates.second; ++it) {
+            if (equalWarning(warnings[it->second], message, detail, code, location)) {
                 return;
             }
         }
 
-        warnings.push_back(warning);
+        warningIndex.emplace(hash, warnings.size());
+        warnings.push_back(ConversionWarning{ message, std::move(detail), code, location });
+    }
+
+    snowcrash::Warnings ConversionContext::TakeWarnings()
+    {
+        snowcrash::Warnings result;
+        result.reserve(warnings.size());
+
+        for (auto& warning : warnings) {
+            result.emplace_back(warning.text(), warning.code, std::move(warning.location));
+        }
+
+        warnings.clear();
+        warningIndex.clear();
+
+        return result;
     }
-}
\ No newline at end of file
+}
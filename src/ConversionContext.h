@@ -8,6 +8,12 @@
 #ifndef DRAFTER_CONVERSIONCONTEXT_H
 #define DRAFTER_CONVERSIONCONTEXT_H
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "NamedTypesRegistry.h"
+#include "StageClock.h"
 #include "refract/Registry.h"
 #include "snowcrash.h"
 
@@ -16,13 +22,32 @@ namespace drafter
 
     struct WrapperOptions;
 
+    /// Warning of the conversion, formatted to a snowcrash::Warning only when taken out of the context
+    struct ConversionWarning {
+        const char* message;             //< static text of the warning
+        std::string detail;              //< appended to the message, empty if none
+        int code;                        //< snowcrash warning or error code
+        mdp::CharactersRangeSet location;
+
+        /// Format the text of the warning
+        std::string text() const;
+    };
+
+    typedef std::vector<ConversionWarning> ConversionWarnings;
+
     class ConversionContext
     {
         refract::Registry registry;
+        NamedTypeDependencies namedTypeDependencies;
+
+        ConversionWarnings warnings;
+        std::unordered_multimap<std::size_t, std::size_t> warningIndex; //< hash of warning -> index in warnings
 
     public:
         const WrapperOptions& options;
-        std::vector<snowcrash::Warning> warnings;
+
+        /// Clock of the conversion stages, running only if statistics are requested
+        StageClock clock;
 
         inline refract::Registry& GetNamedTypesRegistry()
         {
@@ -34,9 +59,37 @@ namespace drafter
             return registry;
         }
 
-        ConversionContext(const WrapperOptions& options) : options(options) {}
+        inline NamedTypeDependencies& GetNamedTypeDependencies()
+        {
+            return namedTypeDependencies;
+        }
+
+        inline const NamedTypeDependencies& GetNamedTypeDependencies() const
+        {
+            return namedTypeDependencies;
+        }
+
+        ConversionContext(const WrapperOptions& options, drafter_parse_stats* stats = nullptr)
+            : options(options), clock(stats)
+        {
+        }
+
+        /// Add the warning unless an equal one was added already, the location is copied only if it is not
+        ///
+        /// @param message  static text of the warning, it is not copied
+        /// @param detail   text appended to the message when the warning is formatted
+        void warn(const char* message,
+            int code,
+            const mdp::CharactersRangeSet& location = mdp::CharactersRangeSet(),
+            std::string detail = std::string());
+
+        inline const ConversionWarnings& GetWarnings() const
+        {
+            return warnings;
+        }
 
-        void warn(const snowcrash::Warning& warning);
+        /// Format all the warnings, moving them out of the context
+        snowcrash::Warnings TakeWarnings();
     };
 }
 #endif // #ifndef DRAFTER_CONVERSIONCONTEXT_H
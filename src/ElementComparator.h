@@ -10,7 +10,6 @@
 
 #include "refract/InfoElements.h"
 #include <algorithm>
-#include <iterator>
 #include <type_traits>
 
 namespace drafter
@@ -18,32 +17,6 @@ namespace drafter
 
     namespace detail
     {
-        struct SortedRef {
-            using InfoRef = std::vector<std::reference_wrapper<const refract::InfoElements::value_type> >;
-
-            template <typename IgnorePredicate>
-            InfoRef operator()(const refract::InfoElements& infoElements, IgnorePredicate&& ignore) const
-            {
-                InfoRef res;
-
-                std::transform(infoElements.begin(), infoElements.end(), std::back_inserter(res), [](auto& info) {
-                    return std::cref(info);
-                });
-
-                res.erase(std::remove_if(res.begin(),
-                              res.end(),
-                              [ignoreKey = std::forward<IgnorePredicate>(ignore)](const auto& entry) //
-                              {                                                                      //
-                                  return ignoreKey(entry.get().first);                               //
-                              }),
-                    res.end());
-
-                std::sort(res.begin(), res.end(), [](auto l, auto r) { return l.get().first < r.get().first; });
-
-                return res;
-            }
-        };
-
         struct IgnoreNone {
             bool operator()(const std::string&) const noexcept
             {
@@ -65,13 +38,21 @@ namespace drafter
 
             explicit InfoElementsComparator(IgnorePredicate ignoreKey) : ignore{ std::move(ignoreKey) } {}
 
+            /// Order insensitive comparison; relies on InfoElements keys being unique
             bool operator()(const refract::InfoElements& rhs, const refract::InfoElements& lhs) const
             {
-                const auto l = SortedRef()(lhs, ignore);
-                const auto r = SortedRef()(rhs, ignore);
+                const auto notIgnored = [this](const auto& entry) { return !ignore(entry.first); };
+
+                if (std::count_if(lhs.begin(), lhs.end(), notIgnored)
+                    != std::count_if(rhs.begin(), rhs.end(), notIgnored))
+                    return false;
+
+                return std::all_of(lhs.begin(), lhs.end(), [this, &rhs](const auto& entry) {
+                    if (ignore(entry.first))
+                        return true;
 
-                return std::equal(l.begin(), l.end(), r.begin(), r.end(), [](const auto& l, const auto& r) {
-                    return l.get().first == r.get().first && *l.get().second.get() == *r.get().second.get();
+                    const auto match = rhs.find(entry.first);
+                    return match != rhs.end() && *entry.second.get() == *match->second.get();
                 });
             }
         };
@@ -1,7 +1,10 @@
 #include "NamedTypesRegistry.h"
 
 #include <algorithm>
+#include <functional>
 #include <map>
+#include <numeric>
+#include <queue>
 #include <set>
 #include <string>
 
@@ -184,30 +187,6 @@ namespace drafter
                 return collectMembers(ds->sections);
             }
 
-            Members collectMembers(const std::string& id, const MembersMap& members, Members& resolved)
-            {
-                Members collected;
-
-                if (resolved.find(id) != resolved.end()) {
-                    return collected;
-                }
-
-                resolved.insert(id);
-
-                MembersMap::const_iterator member = members.find(id);
-                if (member == members.end()) {
-                    return collected;
-                }
-
-                for (Members::const_iterator i = member->second.begin(); i != member->second.end(); ++i) {
-                    Members sub = collectMembers(*i, members, resolved);
-                    collected.insert(*i);
-                    collected.insert(sub.begin(), sub.end());
-                }
-
-                return collected;
-            }
-
             DependencyTypeInfo(const DataStructures& elements)
             {
 
@@ -225,62 +204,22 @@ namespace drafter
                     }
                 }
 
-                // Map members
-                MembersMap members;
+                // Map direct members
                 for (DataStructures::const_iterator i = elements.begin(); i != elements.end(); ++i) {
-                    members[name(i->node)] = collectMembers(i->node);
-                }
-
-                // Map members into deep
-                for (MembersMap::const_iterator i = members.begin(); i != members.end(); ++i) {
-                    Members resolved;
-                    objectToMembers[i->first] = collectMembers(i->first, members, resolved);
+                    objectToMembers[name(i->node)] = collectMembers(i->node);
                 }
 
 #ifdef DEBUG_DEPENDENCIES
                 // debug out members
                 for (MembersMap::const_iterator i = objectToMembers.begin(); i != objectToMembers.end(); ++i) {
                     std::cout << "Members: " << i->first << std::endl;
-                    for (Members::const_iterator it = objectToMembers[i->first].begin();
-                         it != objectToMembers[i->first].end();
-                         ++it) {
+                    for (Members::const_iterator it = i->second.begin(); it != i->second.end(); ++it) {
                         std::cout << " - " << *it << std::endl;
                     }
                 }
 #endif /* DEBUG_DEPENDENCIES */
             }
 
-            bool hasMember(const snowcrash::DataStructure* object, const snowcrash::DataStructure* member) const
-            {
-                MembersMap::const_iterator members = objectToMembers.find(name(object));
-                if (members == objectToMembers.end()) {
-                    return false;
-                }
-
-                return members->second.find(name(member)) != members->second.end();
-            }
-
-            bool hasAncestor(const snowcrash::DataStructure* object, const snowcrash::DataStructure* ancestor) const
-            {
-                std::string s = name(object);
-                const std::string& isAncestor = name(ancestor);
-
-                while (!s.empty()) {
-                    if (s == isAncestor) {
-                        return true;
-                    }
-
-                    InheritanceMap::const_iterator i = childToParent.find(s);
-                    if (i == childToParent.end()) {
-                        return false;
-                    }
-
-                    s = i->second;
-                }
-
-                return false;
-            }
-
             mson::BaseTypeName GetType(const snowcrash::DataStructure* ds) const
             {
                 return ds->typeDefinition.typeSpecification.name.base;
@@ -314,36 +253,175 @@ namespace drafter
             }
         };
 
-        struct InheritanceComparator {
+        typedef std::vector<std::size_t> Indexes;
+
+        /**
+         * Order named types so every type follows its base type and the
+         * types of its members.
+         *
+         * The strongly connected components of the dependencies are ordered
+         * topologically (Kahn's algorithm), independent components by the
+         * name of their first type. A component of several types, i.e.
+         * mutually recursive types, is registered in name order and recorded
+         * as a cycle in `graph.cycles`.
+         *
+         * The resulting dependency graph is stored in `graph`.
+         */
+        DataStructures OrderByDependencies(
+            const DataStructures& found, const DependencyTypeInfo& typeInfo, NamedTypeDependencies& graph)
+        {
+            const std::size_t size = found.size();
+
+            // rank types by name, the components list their types in rank order
+            Indexes byRank(size);
+            std::iota(byRank.begin(), byRank.end(), 0);
+            std::stable_sort(byRank.begin(), byRank.end(), [&found, &typeInfo](std::size_t l, std::size_t r) {
+                return typeInfo.name(found[l].node) < typeInfo.name(found[r].node);
+            });
+
+            Indexes rank(size);
+            std::map<std::string, std::size_t> byName;
+            for (std::size_t r = 0; r < size; ++r) {
+                rank[byRank[r]] = r;
+                byName[typeInfo.name(found[byRank[r]].node)] = byRank[r];
+            }
 
-            const DependencyTypeInfo& typeInfo;
+            std::vector<Indexes> dependencies(size);
+            std::vector<Indexes> dependents(size);
+            snowcrash::DependencyGraph ranked(size);
 
-            InheritanceComparator(const DependencyTypeInfo& typeInfo) : typeInfo(typeInfo) {}
+            for (std::size_t i = 0; i < size; ++i) {
+                const snowcrash::DataStructure* ds = found[i].node;
 
-            /* This is a comparator for std::sort so it has to compare
-             * objects in strictly weak ordering otherwise it would crash
-             * with sort going out of container bounds, see
-             * http://stackoverflow.com/questions/24048022/what-causes-stdsort-to-access-address-out-of-range
-             * for more details.
-             * The order is following, if F has S as an ancestor or a member
-             * then S < F and conversely, if none of this applies we compare objects by
-             * names to provide some ordering for all objects as we don't
-             * really care.
-             */
-            bool operator()(DataStructures::const_reference first, DataStructures::const_reference second)
-            {
+                auto addDependency = [&](const std::string& dependency) {
+                    auto it = byName.find(dependency);
+                    if (it != byName.end() && it->second != i) {
+                        dependencies[i].push_back(it->second);
+                    }
+                };
+
+                if (typeInfo.hasParent(ds)) {
+                    addDependency(typeInfo.parent(ds));
+                }
 
-                if (typeInfo.hasAncestor(first.node, second.node) || typeInfo.hasMember(first.node, second.node)) {
-                    return false;
+                DependencyTypeInfo::MembersMap::const_iterator members
+                    = typeInfo.objectToMembers.find(typeInfo.name(ds));
+                if (members != typeInfo.objectToMembers.end()) {
+                    std::for_each(members->second.begin(), members->second.end(), addDependency);
                 }
 
-                if (typeInfo.hasAncestor(second.node, first.node) || typeInfo.hasMember(second.node, first.node)) {
-                    return true;
+                std::sort(dependencies[i].begin(), dependencies[i].end());
+                dependencies[i].erase(
+                    std::unique(dependencies[i].begin(), dependencies[i].end()), dependencies[i].end());
+
+                for (std::size_t dependency : dependencies[i]) {
+                    dependents[dependency].push_back(i);
+                    ranked.addDependency(rank[i], rank[dependency]);
                 }
+            }
+
+            ranked.resolveComponents();
+
+            const std::vector<Indexes>& components = ranked.components();
+
+            std::vector<std::size_t> pending(components.size(), 0);
+            std::vector<Indexes> componentDependents(components.size());
 
-                return typeInfo.name(first.node) < typeInfo.name(second.node);
+            for (std::size_t component = 0; component < components.size(); ++component) {
+                for (std::size_t member : components[component]) {
+                    for (std::size_t dependency : ranked.dependencies(member)) {
+                        std::size_t dependencyComponent = ranked.component(dependency);
+                        if (dependencyComponent != component) {
+                            componentDependents[dependencyComponent].push_back(component);
+                            ++pending[component];
+                        }
+                    }
+                }
             }
-        };
+
+            // ready components by the rank of their first type
+            typedef std::pair<std::size_t, std::size_t> ReadyComponent;
+            std::priority_queue<ReadyComponent, std::vector<ReadyComponent>, std::greater<ReadyComponent> > ready;
+
+            for (std::size_t component = 0; component < components.size(); ++component) {
+                if (pending[component] == 0) {
+                    ready.push({ components[component].front(), component });
+                }
+            }
+
+            Indexes order;
+            order.reserve(size);
+
+            std::vector<Indexes> cycles;
+
+            while (!ready.empty()) {
+                const std::size_t component = ready.top().second;
+                ready.pop();
+
+                Indexes members;
+                for (std::size_t member : components[component]) {
+                    members.push_back(byRank[member]);
+                }
+
+                order.insert(order.end(), members.begin(), members.end());
+
+                if (members.size() > 1) {
+                    cycles.push_back(std::move(members));
+                }
+
+                for (std::size_t dependent : componentDependents[component]) {
+                    if (--pending[dependent] == 0) {
+                        ready.push({ components[dependent].front(), dependent });
+                    }
+                }
+            }
+
+            // expose the graph indexed in registration order
+            Indexes position(size);
+            for (std::size_t p = 0; p < size; ++p) {
+                position[order[p]] = p;
+            }
+
+            auto remap = [&position](const Indexes& indexes) {
+                Indexes result;
+                result.reserve(indexes.size());
+                for (std::size_t i : indexes) {
+                    result.push_back(position[i]);
+                }
+                return result;
+            };
+
+            graph.clear();
+            graph.names.reserve(size);
+            graph.dependencies.reserve(size);
+            graph.dependents.reserve(size);
+
+            DataStructures sorted;
+            sorted.reserve(size);
+
+            for (std::size_t i : order) {
+                sorted.push_back(found[i]);
+                graph.names.push_back(typeInfo.name(found[i].node));
+                graph.dependencies.push_back(remap(dependencies[i]));
+                graph.dependents.push_back(remap(dependents[i]));
+                graph.indexes[graph.names.back()] = graph.names.size() - 1;
+            }
+
+            for (const Indexes& cycle : cycles) {
+                graph.cycles.push_back(remap(cycle));
+            }
+
+            graph.resolved = snowcrash::DependencyGraph(size);
+            for (std::size_t i = 0; i < size; ++i) {
+                for (std::size_t dependency : graph.dependencies[i]) {
+                    graph.resolved.addDependency(i, dependency);
+                }
+            }
+
+            graph.resolved.resolveComponents();
+
+            return sorted;
+        }
 
     } // ns anonymous
 
@@ -360,7 +438,7 @@ namespace drafter
 
         DependencyTypeInfo typeInfo(found);
 
-        std::sort(found.begin(), found.end(), InheritanceComparator(typeInfo));
+        found = OrderByDependencies(found, typeInfo, context.GetNamedTypeDependencies());
 
 #ifdef DEBUG_DEPENDENCIES
         std::cout << "==BASE TYPE ORDER==" << std::endl;
@@ -8,7 +8,12 @@
 #ifndef DRAFTER_NAMEDTYPESREGISRTY_H
 #define DRAFTER_NAMEDTYPESREGISRTY_H
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "Blueprint.h"
+#include "DependencyGraph.h"
 
 namespace refract
 {
@@ -23,6 +28,51 @@ namespace drafter
 
     class ConversionContext;
 
+    ///
+    /// Dependency graph of named types (inheritance and members)
+    ///
+    /// Types are indexed in registration order, i.e. every type comes after
+    /// all types it depends on unless they are part of a cycle.
+    ///
+    struct NamedTypeDependencies {
+        using Index = std::size_t;
+        using Indexes = std::vector<Index>;
+
+        std::vector<std::string> names; //< named types in registration order
+        std::vector<Indexes> dependencies; //< direct dependencies (base type, member types) of each type
+        std::vector<Indexes> dependents;   //< direct dependents of each type
+
+        ///
+        /// Dependency cycles (mutually recursive types) found while ordering;
+        /// the first type of each cycle was registered before its dependencies
+        ///
+        std::vector<Indexes> cycles;
+
+        std::unordered_map<std::string, Index> indexes; //< index of each type by name
+
+        ///
+        /// The dependencies with their strongly connected components resolved,
+        /// without the transitive closure
+        ///
+        snowcrash::DependencyGraph resolved;
+
+        /// True if the type depends on itself, i.e. it is (mutually) recursive
+        bool isRecursive(Index type) const
+        {
+            return resolved.isCyclic(type);
+        }
+
+        void clear()
+        {
+            names.clear();
+            dependencies.clear();
+            dependents.clear();
+            cycles.clear();
+            indexes.clear();
+            resolved = snowcrash::DependencyGraph();
+        }
+    };
+
     void RegisterNamedTypes(const NodeInfo<snowcrash::Elements>& elements, ConversionContext& context);
 }
 #endif // #ifndef DRAFTER_NAMEDTYPESREGISRTY_H
@@ -317,13 +317,11 @@ std::unique_ptr<IElement> PayloadToRefract(
     // but there is no way how to do it
     // in current time we solve it by rethrow
     catch (snowcrash::Error& e) {
-        context.warn(snowcrash::Warning("unable to render JSON/JSONSchema. " + e.message,
-            snowcrash::ApplicationError,
-            payload.sourceMap->sourceMap));
+        context.warn(
+            "unable to render JSON/JSONSchema. ", snowcrash::ApplicationError, payload.sourceMap->sourceMap, e.message);
     } catch (LogicError& e) {
-        context.warn(snowcrash::Warning(std::string("unable to render JSON/JSONSchema. ").append(e.what()),
-            snowcrash::ApplicationError,
-            payload.sourceMap->sourceMap));
+        context.warn(
+            "unable to render JSON/JSONSchema. ", snowcrash::ApplicationError, payload.sourceMap->sourceMap, e.what());
     }
 
     RemoveEmptyElements(content);
@@ -448,7 +446,9 @@ std::unique_ptr<ArrayElement> ResourceToRefract(
 
     if (!resource.node->attributes.empty())
         content.push_back(DataStructureToRefract(MAKE_NODE_INFO(resource, attributes), context));
-    NodeInfoToElements(MAKE_NODE_INFO(resource, actions), ActionToRefract, content, context);
+
+    if (context.options.produces(DRAFTER_COMPONENT_TRANSITIONS))
+        NodeInfoToElements(MAKE_NODE_INFO(resource, actions), ActionToRefract, content, context);
 
     RemoveEmptyElements(content);
 
@@ -462,8 +462,22 @@ const snowcrash::SourceMap<snowcrash::Elements>* GetElementChildrenSourceMap(
                                                                       &element.sourceMap->content.elements();
 }
 
+/// The drafter_component flags producing any of which produces the category
+unsigned int CategoryComponents(const NodeInfo<snowcrash::Element>& element)
+{
+    if (element.node->category == snowcrash::Element::DataStructureGroupCategory)
+        return DRAFTER_COMPONENT_DATA_STRUCTURES;
+
+    // Resource groups are produced also as containers of the selected resources
+    return DRAFTER_COMPONENT_CATEGORIES | DRAFTER_COMPONENT_RESOURCES;
+}
+
 std::unique_ptr<ArrayElement> CategoryToRefract(const NodeInfo<snowcrash::Element>& element, ConversionContext& context)
 {
+    if (!context.options.produces(CategoryComponents(element))) {
+        return nullptr;
+    }
+
     auto category = make_element<ArrayElement>();
 
     category->element(SerializeKey::Category);
@@ -495,8 +509,12 @@ std::unique_ptr<IElement> ElementToRefract(const NodeInfo<snowcrash::Element>& e
 {
     switch (element.node->element) {
         case snowcrash::Element::ResourceElement:
+            if (!context.options.produces(DRAFTER_COMPONENT_RESOURCES))
+                return nullptr;
             return ResourceToRefract(MAKE_NODE_INFO(element, content.resource), context);
         case snowcrash::Element::DataStructureElement:
+            if (!context.options.produces(DRAFTER_COMPONENT_DATA_STRUCTURES))
+                return nullptr;
             return DataStructureToRefract(MAKE_NODE_INFO(element, content.dataStructure), context);
         case snowcrash::Element::CopyElement:
             return CopyToRefract(MAKE_NODE_INFO(element, content.copy));
@@ -538,6 +556,105 @@ std::unique_ptr<IElement> drafter::BlueprintToRefract(
     return std::move(ast);
 }
 
+namespace
+{
+    /// Convert the attributes, if any, for their annotations only
+    template <typename T>
+    void CheckAttributes(const NodeInfo<T>& node, ConversionContext& context)
+    {
+        if (!node.node->attributes.empty())
+            DataStructureToRefract(MAKE_NODE_INFO(node, attributes), context);
+    }
+
+    void CheckAction(const NodeInfo<snowcrash::Action>& action, ConversionContext& context)
+    {
+        CheckAttributes(action, context);
+
+        typedef NodeInfoCollection<snowcrash::TransactionExamples> ExamplesType;
+        ExamplesType examples(MAKE_NODE_INFO(action, examples));
+
+        for (const auto& example : examples) {
+
+            typedef NodeInfoCollection<snowcrash::Requests> RequestsType;
+            RequestsType requests(example.node->requests, example.sourceMap->requests);
+
+            typedef NodeInfoCollection<snowcrash::Responses> ResponsesType;
+            ResponsesType responses(example.node->responses, example.sourceMap->responses);
+
+            // Payloads in the order ActionToRefract converts them first
+            if (requests.empty()) {
+                for (const auto& response : responses)
+                    CheckAttributes(response, context);
+            }
+
+            for (auto request = requests.begin(); request != requests.end(); ++request) {
+                CheckAttributes(*request, context);
+
+                if (request == requests.begin()) {
+                    for (const auto& response : responses)
+                        CheckAttributes(response, context);
+                }
+            }
+        }
+    }
+
+    void CheckResource(const NodeInfo<snowcrash::Resource>& resource, ConversionContext& context)
+    {
+        CheckAttributes(resource, context);
+
+        if (!context.options.produces(DRAFTER_COMPONENT_TRANSITIONS))
+            return;
+
+        typedef NodeInfoCollection<snowcrash::Actions> ActionsType;
+        ActionsType actions(MAKE_NODE_INFO(resource, actions));
+
+        for (const auto& action : actions)
+            CheckAction(action, context);
+    }
+
+    void CheckElements(const NodeInfo<snowcrash::Elements>& elements, ConversionContext& context);
+
+    void CheckElement(const NodeInfo<snowcrash::Element>& element, ConversionContext& context)
+    {
+        switch (element.node->element) {
+            case snowcrash::Element::ResourceElement:
+                if (context.options.produces(DRAFTER_COMPONENT_RESOURCES))
+                    CheckResource(MAKE_NODE_INFO(element, content.resource), context);
+                break;
+            case snowcrash::Element::DataStructureElement:
+                if (context.options.produces(DRAFTER_COMPONENT_DATA_STRUCTURES))
+                    DataStructureToRefract(MAKE_NODE_INFO(element, content.dataStructure), context);
+                break;
+            case snowcrash::Element::CategoryElement:
+                if (context.options.produces(CategoryComponents(element))
+                    && !element.node->content.elements().empty()) {
+                    CheckElements(
+                        MakeNodeInfo(&element.node->content.elements(), GetElementChildrenSourceMap(element)), context);
+                }
+                break;
+            case snowcrash::Element::CopyElement:
+                break;
+            default:
+                // As ElementToRefract does
+                throw snowcrash::Error("unknown type of api description element", snowcrash::ApplicationError);
+        }
+    }
+
+    void CheckElements(const NodeInfo<snowcrash::Elements>& elements, ConversionContext& context)
+    {
+        typedef NodeInfoCollection<snowcrash::Elements> ElementsType;
+        ElementsType collection(elements);
+
+        for (const auto& element : collection)
+            CheckElement(element, context);
+    }
+}
+
+void drafter::CheckBlueprint(const NodeInfo<snowcrash::Blueprint>& blueprint, ConversionContext& context)
+{
+    CheckElements(MAKE_NODE_INFO(blueprint, content.elements()), context);
+}
+
 std::unique_ptr<IElement> drafter::AnnotationToRefract(
     const snowcrash::SourceAnnotation& annotation, const std::string& key)
 {
@@ -28,6 +28,10 @@ namespace drafter
         const NodeInfo<snowcrash::DataStructure>& dataStructure, ConversionContext& context);
     std::unique_ptr<refract::IElement> BlueprintToRefract(
         const NodeInfo<snowcrash::Blueprint>& blueprint, ConversionContext& context);
+
+    /// Convert only the data structures of the blueprint, in the order BlueprintToRefract
+    /// does, for their annotations without building the refract of the API
+    void CheckBlueprint(const NodeInfo<snowcrash::Blueprint>& blueprint, ConversionContext& context);
 }
 
 #endif // #ifndef DRAFTER_REFRACTAST_H
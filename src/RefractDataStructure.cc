@@ -15,10 +15,12 @@
 #include "refract/SerializeVisitor.h"
 #include "refract/PrintVisitor.h"
 #include "refract/InfoElementsUtils.h"
+#include "refract/Hash.h"
 
 #include "NamedTypesRegistry.h"
 #include "RefractElementFactory.h"
 #include "ConversionContext.h"
+#include "Tracing.h"
 
 #include "ElementData.h"
 #include "ElementInfoUtils.h"
@@ -78,10 +80,10 @@ namespace
             auto result = LiteralTo<dsd::Number>(info.value);
 
             if (!std::get<0>(result)) {
-                context.warn(snowcrash::Warning(
+                context.warn(
                     "invalid value format for 'number' type. please check mson specification for valid format",
                     snowcrash::MSONError,
-                    info.sourceMap.sourceMap));
+                    info.sourceMap.sourceMap);
             }
         }
     };
@@ -96,10 +98,9 @@ namespace
             auto result = LiteralTo<dsd::Boolean>(info.value);
 
             if (!std::get<0>(result)) {
-                context.warn(
-                    snowcrash::Warning("invalid value for 'boolean' type. allowed values are 'true' or 'false'",
-                        snowcrash::MSONError,
-                        info.sourceMap.sourceMap));
+                context.warn("invalid value for 'boolean' type. allowed values are 'true' or 'false'",
+                    snowcrash::MSONError,
+                    info.sourceMap.sourceMap);
             }
         }
     };
@@ -398,14 +399,8 @@ namespace
 
     mson::BaseTypeName GetMsonTypeFromName(const std::string& name, const ConversionContext& context)
     {
-        const IElement* e = FindRootAncestor(name, context.GetNamedTypesRegistry());
-        if (!e) {
-            return mson::UndefinedTypeName;
-        }
-
-        TypeQueryVisitor query;
-        VisitBy(*e, query);
-        return RefractElementTypeToMsonType(query.get());
+        const Registry& registry = context.GetNamedTypesRegistry();
+        return RefractElementTypeToMsonType(registry.baseType(registry.handle(name)));
     }
 
     /**
@@ -605,15 +600,15 @@ namespace
                 }
             } else {
                 if (attrs & mson::DefaultTypeAttribute) {
-                    context.warn(snowcrash::Warning("no value present when 'default' is specified",
+                    context.warn("no value present when 'default' is specified",
                         snowcrash::MSONError,
-                        valueMember.sourceMap->sourceMap));
+                        valueMember.sourceMap->sourceMap);
                 }
 
                 if (attrs & mson::SampleTypeAttribute) {
-                    context.warn(snowcrash::Warning("no value present when 'sample' is specified",
+                    context.warn("no value present when 'sample' is specified",
                         snowcrash::MSONError,
-                        valueMember.sourceMap->sourceMap));
+                        valueMember.sourceMap->sourceMap);
                 }
             }
 
@@ -749,19 +744,25 @@ namespace
             auto defaultInfo = Merge<EnumElement>()(std::move(CloneElementInfoContainer<T>(data.defaults)));
 
             dsd::Array enums;
+            std::vector<std::size_t> enumHashes; //< refract::hash of enums, to compare only the same hashes
 
-            auto addToEnumerations = [](auto& info,
+            auto addToEnumerations = [&enumHashes](auto& info,
                                          dsd::Array& enums,
                                          ConversionContext& context,
                                          const auto& sourceMap,
                                          const bool reportDuplicity) {
-                if (std::find_if(enums.begin(), enums.end(), [&info](auto& enm) { return Equal(*info, *enm); })
-                    == enums.end()) {
+                const std::size_t infoHash = refract::hash(*info);
+                auto enm = enums.begin();
+                for (auto enmHash = enumHashes.begin(); enmHash != enumHashes.end(); ++enmHash, ++enm) {
+                    if (*enmHash == infoHash && Equal(*info, **enm))
+                        break;
+                }
 
+                if (enm == enums.end()) {
+                    enumHashes.push_back(infoHash);
                     enums.push_back(std::move(info));
                 } else if (reportDuplicity) {
-                    context.warn(
-                        snowcrash::Warning("duplicit value in enumeration", snowcrash::MSONError, sourceMap.sourceMap));
+                    context.warn("duplicit value in enumeration", snowcrash::MSONError, sourceMap.sourceMap);
                 }
             };
 
@@ -856,7 +857,7 @@ namespace
                 location.append(item.sourceMap.sourceMap);
             }
 
-            context.warn(snowcrash::Warning("multiple definitions of 'default' value", snowcrash::MSONError, location));
+            context.warn("multiple definitions of 'default' value", snowcrash::MSONError, location);
         }
     }
 
@@ -959,12 +960,9 @@ namespace
             return true;
         }
 
-        if (TypeQueryVisitor::as<StringElement>(FindRootAncestor(
-                variable.typeDefinition.typeSpecification.name.symbol.literal, context.GetNamedTypesRegistry()))) {
-            return true;
-        }
-
-        return false;
+        const Registry& registry = context.GetNamedTypesRegistry();
+        return registry.baseType(registry.handle(variable.typeDefinition.typeSpecification.name.symbol.literal))
+            == TypeQueryVisitor::String;
     }
 
     std::unique_ptr<IElement> GetPropertyKey(const NodeInfo<mson::PropertyMember>& property, ConversionContext& context)
@@ -979,9 +977,9 @@ namespace
 
             if (property.node->name.variable.values.size() > 1) {
                 // FIXME: is there example for multiple variables?
-                context.warn(snowcrash::Warning("multiple variables in property definition is not implemented",
+                context.warn("multiple variables in property definition is not implemented",
                     snowcrash::MSONError,
-                    sourceMap.sourceMap));
+                    sourceMap.sourceMap);
             }
 
             // variable containt type definition
@@ -1123,26 +1121,22 @@ namespace
 
         if ((attributes & mson::FixedTypeAttribute) != 0 && (attributes & mson::OptionalTypeAttribute) != 0) {
 
-            context.warn(snowcrash::Warning(
-                "cannot use 'fixed' and 'optional' together", snowcrash::MSONError, sourceMap.sourceMap));
+            context.warn("cannot use 'fixed' and 'optional' together", snowcrash::MSONError, sourceMap.sourceMap);
         }
 
         if ((attributes & mson::RequiredTypeAttribute) != 0 && (attributes & mson::OptionalTypeAttribute) != 0) {
 
-            context.warn(snowcrash::Warning(
-                "cannot use 'required' and 'optional' together", snowcrash::MSONError, sourceMap.sourceMap));
+            context.warn("cannot use 'required' and 'optional' together", snowcrash::MSONError, sourceMap.sourceMap);
         }
 
         if ((attributes & mson::DefaultTypeAttribute) != 0 && (attributes & mson::SampleTypeAttribute) != 0) {
 
-            context.warn(snowcrash::Warning(
-                "cannot use 'default' and 'sample' together", snowcrash::MSONError, sourceMap.sourceMap));
+            context.warn("cannot use 'default' and 'sample' together", snowcrash::MSONError, sourceMap.sourceMap);
         }
 
         if ((attributes & mson::FixedTypeAttribute) != 0 && (attributes & mson::FixedTypeTypeAttribute) != 0) {
 
-            context.warn(snowcrash::Warning(
-                "cannot use 'fixed' and 'fixed-type' together", snowcrash::MSONError, sourceMap.sourceMap));
+            context.warn("cannot use 'fixed' and 'fixed-type' together", snowcrash::MSONError, sourceMap.sourceMap);
         }
     }
 
@@ -1311,6 +1305,9 @@ std::unique_ptr<IElement> drafter::MSONToRefract(
         return nullptr;
     }
 
+    StageScope stage(context.clock, DRAFTER_STAGE_MSON);
+    TRACE_SPAN_DETAIL("MSONToRefract", dataStructure.node->name.symbol.literal);
+
     mson::BaseTypeName nameType = GetType(*dataStructure.node, context);
 
     switch (nameType) {
@@ -1338,6 +1335,10 @@ std::unique_ptr<IElement> drafter::ExpandRefract(std::unique_ptr<IElement> eleme
         return nullptr;
     }
 
+    StageScope stage(context.clock, DRAFTER_STAGE_EXPANSION);
+
+    TRACE_SPAN_DETAIL("ExpandVisitor", element->element());
+
     ExpandVisitor expander(context.GetNamedTypesRegistry());
     Visit(expander, *element);
 
@@ -1354,6 +1355,8 @@ sos::Object drafter::SerializeRefract(const IElement* element, ConversionContext
         return sos::Object();
     }
 
+    TRACE_SPAN_DETAIL("SosSerializeVisitor", element->element());
+
     SosSerializeVisitor serializer(context.options.generateSourceMap);
     Visit(serializer, *element);
 
@@ -14,6 +14,7 @@
 #include "RegexMatch.h"
 
 #include "ConversionContext.h"
+#include "Tracing.h"
 
 #include "refract/RenderJSONVisitor.h"
 #include "refract/JsonSchema.h"
@@ -54,9 +55,14 @@ namespace drafter
     NodeInfoByValue<Asset> renderPayloadBody(
         const NodeInfo<Payload>& payload, const NodeInfo<Action>& action, ConversionContext& context)
     {
+        StageScope stage(context.clock, DRAFTER_STAGE_RENDERING);
 
         NodeInfoByValue<Asset> body = std::make_pair(payload.node->body, &payload.sourceMap->body);
 
+        if (!context.options.produces(DRAFTER_COMPONENT_GENERATED_BODIES)) {
+            return body;
+        }
+
         NodeInfo<Attributes> payloadAttributes = MAKE_NODE_INFO(payload, attributes);
         NodeInfo<Attributes> actionAttributes = MAKE_NODE_INFO(action, attributes);
 
@@ -90,6 +96,8 @@ namespace drafter
         // One of this will always execute since we have a catch above for not having render format
         switch (renderFormat) {
             case JSONRenderFormat: {
+                TRACE_SPAN_DETAIL("RenderJSONVisitor", expanded->element());
+
                 refract::RenderJSONVisitor renderer;
                 refract::Visit(renderer, *expanded);
                 return std::make_pair(renderer.getString(), NodeInfo<Asset>::NullSourceMap());
@@ -114,9 +122,14 @@ namespace drafter
         const NodeInfo<snowcrash::Action>& action,
         ConversionContext& context)
     {
+        StageScope stage(context.clock, DRAFTER_STAGE_RENDERING);
 
         NodeInfoByValue<Asset> schema = std::make_pair(payload.node->schema, &payload.sourceMap->schema);
 
+        if (!context.options.produces(DRAFTER_COMPONENT_GENERATED_SCHEMAS)) {
+            return schema;
+        }
+
         NodeInfo<Attributes> payloadAttributes = MAKE_NODE_INFO(payload, attributes);
         NodeInfo<Attributes> actionAttributes = MAKE_NODE_INFO(action, attributes);
 
@@ -14,6 +14,7 @@
 #include "sos.h"
 
 #include "NodeInfo.h"
+#include "drafter.h"
 
 #include "refract/Element.h"
 #include "refract/Registry.h"
@@ -44,15 +45,58 @@ namespace drafter
     struct WrapperOptions {
         const bool generateSourceMap;
         const bool expandMSON;
+        const bool annotationsOnly;    // collect annotations only, without building the API refract
+        const unsigned int components; // drafter_component flags of the parse result parts to produce
+
+        WrapperOptions(const bool generateSourceMap,
+            const bool expandMSON,
+            const bool annotationsOnly = false,
+            const unsigned int components = DRAFTER_COMPONENT_ALL)
+            : generateSourceMap(generateSourceMap),
+              expandMSON(expandMSON),
+              annotationsOnly(annotationsOnly),
+              components(ProducedComponents(annotationsOnly, components))
+        {
+        }
+
+        WrapperOptions(const bool generateSourceMap)
+            : generateSourceMap(generateSourceMap),
+              expandMSON(false),
+              annotationsOnly(false),
+              components(DRAFTER_COMPONENT_ALL)
+        {
+        }
 
-        WrapperOptions(const bool generateSourceMap, const bool expandMSON)
-            : generateSourceMap(generateSourceMap), expandMSON(expandMSON)
+        WrapperOptions()
+            : generateSourceMap(false), expandMSON(false), annotationsOnly(false), components(DRAFTER_COMPONENT_ALL)
         {
         }
 
-        WrapperOptions(const bool generateSourceMap) : generateSourceMap(generateSourceMap), expandMSON(false) {}
+        /// \returns True if any of the components is produced
+        bool produces(const unsigned int component) const
+        {
+            return (components & component) != 0;
+        }
 
-        WrapperOptions() : generateSourceMap(false), expandMSON(false) {}
+    private:
+        /// \returns The selected components with their containers
+        static unsigned int ProducedComponents(const bool annotationsOnly, unsigned int components)
+        {
+            if (annotationsOnly) {
+                components = DRAFTER_COMPONENT_ALL & ~(DRAFTER_COMPONENT_GENERATED_BODIES
+                                                         | DRAFTER_COMPONENT_GENERATED_SCHEMAS);
+            }
+
+            if (components & (DRAFTER_COMPONENT_GENERATED_BODIES | DRAFTER_COMPONENT_GENERATED_SCHEMAS)) {
+                components |= DRAFTER_COMPONENT_TRANSITIONS;
+            }
+
+            if (components & DRAFTER_COMPONENT_TRANSITIONS) {
+                components |= DRAFTER_COMPONENT_RESOURCES;
+            }
+
+            return components;
+        }
     };
 
     /**
@@ -48,9 +48,16 @@ std::unique_ptr<IElement> drafter::WrapRefract(
 
     if (blueprint.report.error.code == snowcrash::Error::OK) {
         try {
-            RegisterNamedTypes(
-                MakeNodeInfo(blueprint.node.content.elements(), blueprint.sourceMap.content.elements()), context);
-            blueprintRefract = BlueprintToRefract(MakeNodeInfo(blueprint.node, blueprint.sourceMap), context);
+            {
+                StageScope stage(context.clock, DRAFTER_STAGE_NAMED_TYPES);
+                RegisterNamedTypes(
+                    MakeNodeInfo(blueprint.node.content.elements(), blueprint.sourceMap.content.elements()), context);
+            }
+
+            if (context.options.annotationsOnly)
+                CheckBlueprint(MakeNodeInfo(blueprint.node, blueprint.sourceMap), context);
+            else
+                blueprintRefract = BlueprintToRefract(MakeNodeInfo(blueprint.node, blueprint.sourceMap), context);
         } catch (std::exception& e) {
             error = snowcrash::Error(e.what(), snowcrash::MSONError);
         } catch (snowcrash::Error& e) {
@@ -68,15 +75,20 @@ std::unique_ptr<IElement> drafter::WrapRefract(
         }
     }
 
+    if (!context.options.produces(DRAFTER_COMPONENT_ANNOTATIONS)) {
+        return parseResult;
+    }
+
     if (blueprint.report.error.code != snowcrash::Error::OK) {
         parseResult->get().push_back(helper::AnnotationToRefract(SerializeKey::Error)(blueprint.report.error));
     }
 
     snowcrash::Warnings& warnings = blueprint.report.warnings;
+    snowcrash::Warnings conversionWarnings = context.TakeWarnings();
 
-    if (!context.warnings.empty()) {
-        warnings.insert(warnings.end(), context.warnings.begin(), context.warnings.end());
-    }
+    warnings.insert(warnings.end(),
+        std::make_move_iterator(conversionWarnings.begin()),
+        std::make_move_iterator(conversionWarnings.end()));
 
     if (!warnings.empty()) {
         std::transform(warnings.begin(),
@@ -0,0 +1,102 @@
+//
+//  StageClock.h
+//  drafter
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#ifndef DRAFTER_STAGECLOCK_H
+#define DRAFTER_STAGECLOCK_H
+
+#include <chrono>
+#include <utility>
+
+#include "drafter.h"
+
+namespace drafter
+{
+
+    ///
+    /// Accumulates the wall time of the stages into the parsing statistics
+    ///
+    /// Time spent in a nested stage is not added to the enclosing one. Time
+    /// outside of any stage is added to DRAFTER_STAGE_REFRACT. Without the
+    /// statistics the clock does nothing.
+    ///
+    class StageClock
+    {
+        typedef std::chrono::steady_clock Clock;
+
+        drafter_parse_stats* stats;
+        drafter_stage stage;
+        Clock::time_point since;
+
+        void lap()
+        {
+            Clock::time_point now = Clock::now();
+            stats->stageTime[stage] += std::chrono::duration<double>(now - since).count();
+            since = now;
+        }
+
+    public:
+        explicit StageClock(drafter_parse_stats* stats = nullptr) : stats(stats), stage(DRAFTER_STAGE_REFRACT)
+        {
+            if (stats)
+                since = Clock::now();
+        }
+
+        /// Switch to the stage, @return the stage switched from
+        drafter_stage enter(drafter_stage next)
+        {
+            if (!stats)
+                return next;
+
+            lap();
+            std::swap(stage, next);
+
+            return next;
+        }
+
+        /// Switch back to the stage entered from
+        void leave(drafter_stage previous)
+        {
+            if (!stats)
+                return;
+
+            lap();
+            stage = previous;
+        }
+
+        /// Add the time of the current stage and stop the clock
+        void stop()
+        {
+            if (!stats)
+                return;
+
+            lap();
+            stats = nullptr;
+        }
+    };
+
+    ///
+    /// Runs its scope in the stage
+    ///
+    class StageScope
+    {
+        StageClock& clock;
+        drafter_stage previous;
+
+    public:
+        StageScope(StageClock& clock, drafter_stage stage) : clock(clock), previous(clock.enter(stage)) {}
+
+        ~StageScope()
+        {
+            clock.leave(previous);
+        }
+
+        StageScope(const StageScope&) = delete;
+        StageScope& operator=(const StageScope&) = delete;
+    };
+}
+
+#endif // #ifndef DRAFTER_STAGECLOCK_H
@@ -11,6 +11,14 @@
 #include "config.h"
 #include "cmdline.h"
 
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+#if !defined(_WIN32)
+#include <glob.h>
+#endif
+
 #include "Version.h"
 
 namespace config
@@ -25,6 +33,30 @@ namespace config
     static const std::string Version = "version";
     static const std::string UseLineNumbers = "use-line-num";
     static const std::string EnableLog = "enable-log";
+    static const std::string Normalize = "normalize";
+    static const std::string Stats = "stats";
+    static const std::string Trace = "trace";
+    static const std::string Serve = "serve";
+    static const std::string MaxRequestSize = "max-request-size";
+    static const std::string Jobs = "jobs";
+    static const std::string NDJSON = "ndjson";
+    static const std::string Components = "components";
+
+    struct Component {
+        const char* name;
+        drafter_component flag;
+    };
+
+    static const Component ComponentNames[] = {
+        { "categories", DRAFTER_COMPONENT_CATEGORIES },
+        { "resources", DRAFTER_COMPONENT_RESOURCES },
+        { "transitions", DRAFTER_COMPONENT_TRANSITIONS },
+        { "data-structures", DRAFTER_COMPONENT_DATA_STRUCTURES },
+        { "bodies", DRAFTER_COMPONENT_GENERATED_BODIES },
+        { "schemas", DRAFTER_COMPONENT_GENERATED_SCHEMAS },
+        { "sourcemaps", DRAFTER_COMPONENT_SOURCE_MAPS },
+        { "annotations", DRAFTER_COMPONENT_ANNOTATIONS },
+    };
 };
 
 void PrepareCommanLineParser(cmdline::parser& parser)
@@ -45,35 +77,123 @@ void PrepareCommanLineParser(cmdline::parser& parser)
     parser.add(
         config::UseLineNumbers, 'u', "use line and row number instead of character index when printing annotation");
     parser.add(config::EnableLog, 'L', "enable logging");
+    parser.add(config::Normalize, 'n', "expand tabs and convert CRLF line endings of the input");
+    parser.add(config::Stats, '\0', "print time spent in the parsing stages and element counts");
+    parser.add<std::string>(config::Trace, '\0', "save traced spans into file in Chrome trace event format", false);
+    parser.add(config::Serve, '\0', "answer length-prefixed parse requests read from stdin until its end");
+    parser.add<int>(config::MaxRequestSize,
+        '\0',
+        "largest blueprint in bytes accepted by --serve, larger requests are answered with an error",
+        false,
+        64 * 1024 * 1024,
+        cmdline::range(1, std::numeric_limits<int>::max()));
+    parser.add<int>(
+        config::Jobs, 'j', "number of input files parsed concurrently", false, 1, cmdline::range(1, 1024));
+    parser.add(config::NDJSON, '\0', "write the Parse Results of all input files as one JSON object per line");
+    parser.add<std::string>(config::Components,
+        '\0',
+        "comma separated parts of the Parse Result to produce (categories|resources|transitions|data-structures|"
+        "bodies|schemas|sourcemaps|annotations)",
+        false);
 
     std::stringstream ss;
 
-    ss << "<input file>\n\n";
+    ss << "<input file> ...\n\n";
     ss << "API Blueprint Parser\n";
     ss << "If called without <input file>, 'drafter' will listen on stdin.\n";
+    ss << "With more input files (or a quoted glob pattern), the Parse Result of each file\n";
+    ss << "is saved next to it as <input file>.yaml or <input file>.json, unless --ndjson is used.\n";
 
     parser.footer(ss.str());
 }
 
 void ValidateParsedCommandLine(const cmdline::parser& parser, const Config& config)
 {
-    if (parser.rest().size() > 1) {
-        std::cerr << "one input file expected, got " << parser.rest().size() << std::endl;
-        exit(EXIT_FAILURE);
-    }
-
     if (parser.exist(config::Version)) {
         std::cout << DRAFTER_VERSION_STRING << std::endl;
         exit(EXIT_SUCCESS);
     }
 
-    if (config.validate) {
+    if (config.serve && !config.inputs.empty()) {
+        std::cerr << "no input file expected while serving, requests are read from stdin" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    if (config.ndjson && config.inputs.empty()) {
+        std::cerr << "input files expected with --ndjson" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    if (config.inputs.size() > 1) {
+        if (parser.exist(config::Output) && !config.ndjson) {
+            std::cerr << "more input files can be saved into one output file only with --ndjson" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+
+        if (config.stats) {
+            std::cerr << "one input file expected with --stats, got " << config.inputs.size() << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (config.validate && !config.serve) {
         if (parser.exist(config::Output)) {
             std::cerr << "WARN: While validation is enabled, output file will not be created" << std::endl;
         }
     }
 }
 
+/**
+ *  \brief Convert a comma separated list of component names into drafter_component flags
+ *
+ *  side effect - calls exit() if there is an unknown component
+ */
+unsigned int ParseComponents(const std::string& list)
+{
+    unsigned int components = 0;
+    std::stringstream ss(list);
+    std::string name;
+
+    while (std::getline(ss, name, ',')) {
+        auto component = std::find_if(std::begin(config::ComponentNames),
+            std::end(config::ComponentNames),
+            [&name](const config::Component& c) { return name == c.name; });
+
+        if (component == std::end(config::ComponentNames)) {
+            std::cerr << "unknown component '" << name << "'" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+
+        components |= component->flag;
+    }
+
+    return components;
+}
+
+/**
+ *  \brief Append the files matching a glob pattern, or the argument itself if nothing matches
+ *
+ *  Lets the patterns be quoted to get around the argument length limits of the shell.
+ */
+void ExpandInput(const std::string& argument, std::vector<std::string>& inputs)
+{
+#if !defined(_WIN32)
+    if (argument.find_first_of("*?[") != std::string::npos) {
+        glob_t matches{};
+
+        if (glob(argument.c_str(), 0, nullptr, &matches) == 0) {
+            inputs.insert(inputs.end(), matches.gl_pathv, matches.gl_pathv + matches.gl_pathc);
+            globfree(&matches);
+            return;
+        }
+
+        globfree(&matches);
+    }
+#endif
+
+    inputs.push_back(argument);
+}
+
 void ParseCommadLineOptions(int argc, const char* argv[], /* out */ Config& conf)
 {
     cmdline::parser parser;
@@ -81,8 +201,14 @@ void ParseCommadLineOptions(int argc, const char* argv[], /* out */ Config& conf
 
     parser.parse_check(argc, argv);
 
-    if (!parser.rest().empty()) {
-        conf.input = parser.rest().front();
+    conf.inputs.clear();
+
+    for (const auto& argument : parser.rest()) {
+        ExpandInput(argument, conf.inputs);
+    }
+
+    if (!conf.inputs.empty()) {
+        conf.input = conf.inputs.front();
     }
 
     conf.lineNumbers = parser.exist(config::UseLineNumbers);
@@ -91,6 +217,14 @@ void ParseCommadLineOptions(int argc, const char* argv[], /* out */ Config& conf
     conf.output = parser.get<std::string>(config::Output);
     conf.sourceMap = parser.exist(config::Sourcemap);
     conf.enableLog = parser.exist(config::EnableLog);
+    conf.normalize = parser.exist(config::Normalize);
+    conf.stats = parser.exist(config::Stats);
+    conf.trace = parser.get<std::string>(config::Trace);
+    conf.serve = parser.exist(config::Serve);
+    conf.maxRequestSize = parser.get<int>(config::MaxRequestSize);
+    conf.jobs = parser.get<int>(config::Jobs);
+    conf.ndjson = parser.exist(config::NDJSON);
+    conf.components = ParseComponents(parser.get<std::string>(config::Components));
 
     ValidateParsedCommandLine(parser, conf);
 }
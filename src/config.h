@@ -9,18 +9,29 @@
 #ifndef DRAFTER_CONFIG_H
 #define DRAFTER_CONFIG_H
 
+#include <cstddef>
 #include <string>
+#include <vector>
 
 #include "Serialize.h"
 
 struct Config {
     std::string input;
+    std::vector<std::string> inputs;
+    unsigned jobs;
+    bool ndjson;
     bool lineNumbers;
     bool validate;
     drafter::SerializeFormat format;
     bool sourceMap;
     std::string output;
     bool enableLog;
+    bool normalize;
+    bool stats;
+    std::string trace;
+    bool serve;
+    size_t maxRequestSize; // bytes of a blueprint accepted while serving
+    unsigned int components; // drafter_component flags, 0 for all of them
 };
 
 /**
@@ -10,15 +10,16 @@
 #include "snowcrash.h"
 
 #include "refract/Element.h"
-#include "refract/FilterVisitor.h"
-#include "refract/Query.h"
 #include "refract/Iterate.h"
+#include "refract/TypeQueryVisitor.h"
 
 #include "SerializeResult.h"      // FIXME: remove - actualy required by WrapParseResultRefract()
 #include "Serialize.h"            // FIXME: remove - actualy required by WrapperOptions
 #include "ConversionContext.h"    // FIXME: remove - required by ConversionContext
 #include "RefractDataStructure.h" // FIXME: remove - required by SerializeRefract()
 
+#include "StageClock.h"
+
 #include "sos.h" // FIXME: remove sos dependency
 #include "sosJSON.h"
 #include "sosYAML.h"
@@ -26,12 +27,49 @@
 #include "Version.h"
 
 #include <string.h>
+#include <algorithm>
+
+namespace
+{
+    /// Copy of the extended options, the options past the size set by the caller get their defaults
+    drafter_parse_options_ex ExtendedOptions(const drafter_parse_options_ex* parse_opts)
+    {
+        drafter_parse_options_ex options;
+        memset(&options, 0, sizeof(options));
+
+        if (parse_opts) {
+            memcpy(&options, parse_opts, std::min(parse_opts->size, sizeof(options)));
+        }
+
+        options.size = sizeof(options);
+
+        return options;
+    }
+
+    drafter_parse_options_ex ExtendedOptions(const drafter_parse_options& parse_opts)
+    {
+        drafter_parse_options_ex options = ExtendedOptions(nullptr);
+        options.requireBlueprintName = parse_opts.requireBlueprintName;
+
+        return options;
+    }
+}
 
 DRAFTER_API drafter_error drafter_parse_blueprint_to(const char* source,
     char** out,
     const drafter_parse_options parse_opts,
     const drafter_serialize_options serialize_opts)
 {
+    const drafter_parse_options_ex options = ExtendedOptions(parse_opts);
+
+    return drafter_parse_blueprint_to_ex(source, out, &options, serialize_opts);
+}
+
+DRAFTER_API drafter_error drafter_parse_blueprint_to_ex(const char* source,
+    char** out,
+    const drafter_parse_options_ex* parse_opts,
+    const drafter_serialize_options serialize_opts)
+{
 
     if (!source) {
         return DRAFTER_EINVALID_INPUT;
@@ -41,16 +79,23 @@ DRAFTER_API drafter_error drafter_parse_blueprint_to(const char* source,
         return DRAFTER_EINVALID_OUTPUT;
     }
 
+    const drafter_parse_options_ex options = ExtendedOptions(parse_opts);
+
     drafter_result* result = nullptr;
     *out = nullptr;
 
-    drafter_error ret = drafter_parse_blueprint(source, &result, parse_opts);
+    drafter_error ret = drafter_parse_blueprint_ex(source, &result, &options);
 
     if (!result) {
         return ret;
     }
 
-    *out = drafter_serialize(result, serialize_opts);
+    {
+        drafter::StageClock clock(options.stats);
+        drafter::StageScope stage(clock, DRAFTER_STAGE_SERIALIZATION);
+
+        *out = drafter_serialize(result, serialize_opts);
+    }
 
     drafter_free_result(result);
 
@@ -59,11 +104,119 @@ DRAFTER_API drafter_error drafter_parse_blueprint_to(const char* source,
 
 namespace sc = snowcrash;
 
+namespace
+{
+    /// Counts the API elements of the parse result into the statistics
+    struct ElementCounter {
+        drafter_parse_stats& stats;
+
+        template <typename T>
+        void operator()(const T& e)
+        {
+            const std::string name = e.element();
+
+            if (name == drafter::SerializeKey::Resource) {
+                ++stats.resourceCount;
+            } else if (name == drafter::SerializeKey::Transition) {
+                ++stats.actionCount;
+            } else if (name == drafter::SerializeKey::DataStructure) {
+                ++stats.dataStructureCount;
+            } else if (name == drafter::SerializeKey::Annotation) {
+                ++stats.annotationCount;
+            }
+        }
+    };
+
+    void CollectStats(drafter_parse_stats& stats,
+        const sc::ParseStatistics& parseStatistics,
+        const refract::IElement& result,
+        const refract::ElementCounters& initialCounters)
+    {
+        stats.stageTime[DRAFTER_STAGE_MARKDOWN] = parseStatistics.markdownTime;
+        stats.stageTime[DRAFTER_STAGE_SECTIONS] = parseStatistics.sectionsTime;
+        stats.stageTime[DRAFTER_STAGE_LAZY_REFERENCES] = parseStatistics.lazyReferencesTime;
+
+        // Only the elements of the result are left alive once the conversion is done
+        const refract::ElementCounters& counters = refract::elementCounters();
+        stats.elementCount = counters.alive() - initialCounters.alive();
+        stats.elementsCreated = counters.created - initialCounters.created;
+        stats.peakElements = counters.peak - initialCounters.alive();
+
+        ElementCounter counter{ stats };
+        refract::Iterate<refract::Recursive> iterate(counter);
+        iterate(result);
+    }
+}
+
+namespace
+{
+    drafter_error ParseBlueprint(const char* source,
+        drafter_result** out,
+        const drafter_parse_options_ex& parse_opts,
+        const drafter::WrapperOptions& wrapperOptions)
+    {
+        sc::BlueprintParserOptions scOptions = 0;
+
+        if (wrapperOptions.produces(DRAFTER_COMPONENT_SOURCE_MAPS)) {
+            scOptions |= sc::ExportSourcemapOption;
+        }
+
+        if (parse_opts.requireBlueprintName) {
+            scOptions |= sc::RequireBlueprintNameOption;
+        }
+
+        if (parse_opts.normalizeSource) {
+            scOptions |= sc::NormalizeSourceOption;
+        }
+
+        drafter_parse_stats* stats = parse_opts.stats;
+        sc::ParseStatistics parseStatistics;
+        refract::ElementCounters initialCounters;
+        refract::ElementCountingScope counting(stats != nullptr);
+
+        if (stats) {
+            *stats = drafter_parse_stats();
+
+            // Peak of the elements alive during this parsing only
+            refract::ElementCounters& counters = refract::elementCounters();
+            counters.peak = counters.alive();
+            initialCounters = counters;
+        }
+
+        sc::ParseResult<sc::Blueprint> blueprint;
+        sc::parse(source, scOptions, blueprint, stats ? &parseStatistics : nullptr);
+
+        std::unique_ptr<refract::IElement> result;
+
+        {
+            drafter::ConversionContext context(wrapperOptions, stats);
+            result = WrapRefract(blueprint, context);
+            context.clock.stop();
+        }
+
+        if (stats) {
+            CollectStats(*stats, parseStatistics, *result, initialCounters);
+        }
+
+        *out = result.release();
+
+        return (drafter_error)blueprint.report.error.code;
+    }
+}
+
 /* Parse API Bleuprint and return result, which is a opaque handle for
  * later use*/
 DRAFTER_API drafter_error drafter_parse_blueprint(
     const char* source, drafter_result** out, const drafter_parse_options parse_opts)
 {
+    const drafter_parse_options_ex options = ExtendedOptions(parse_opts);
+
+    return drafter_parse_blueprint_ex(source, out, &options);
+}
+
+DRAFTER_API drafter_error drafter_parse_blueprint_ex(
+    const char* source, drafter_result** out, const drafter_parse_options_ex* parse_opts)
+{
 
     if (!source) {
         return DRAFTER_EINVALID_INPUT;
@@ -73,22 +226,11 @@ DRAFTER_API drafter_error drafter_parse_blueprint(
         return DRAFTER_EINVALID_OUTPUT;
     }
 
-    sc::BlueprintParserOptions scOptions = sc::ExportSourcemapOption;
+    const drafter_parse_options_ex options = ExtendedOptions(parse_opts);
+    const unsigned int components
+        = options.components ? options.components : static_cast<unsigned int>(DRAFTER_COMPONENT_ALL);
 
-    if (parse_opts.requireBlueprintName) {
-        scOptions |= sc::RequireBlueprintNameOption;
-    }
-
-    sc::ParseResult<sc::Blueprint> blueprint;
-    sc::parse(source, scOptions, blueprint);
-
-    drafter::WrapperOptions wrapperOptions;
-    drafter::ConversionContext context(wrapperOptions);
-    auto result = WrapRefract(blueprint, context);
-
-    *out = result.release();
-
-    return (drafter_error)blueprint.report.error.code;
+    return ParseBlueprint(source, out, options, drafter::WrapperOptions(false, false, false, components));
 }
 
 namespace
@@ -156,40 +298,37 @@ DRAFTER_API char* drafter_serialize(drafter_result* res, const drafter_serialize
 DRAFTER_API drafter_error drafter_check_blueprint(
     const char* source, drafter_result** res, const drafter_parse_options parse_opts)
 {
+    const drafter_parse_options_ex options = ExtendedOptions(parse_opts);
+
+    return drafter_check_blueprint_ex(source, res, &options);
+}
+
+DRAFTER_API drafter_error drafter_check_blueprint_ex(
+    const char* source, drafter_result** res, const drafter_parse_options_ex* parse_opts)
+{
 
     if (!source) {
         return DRAFTER_EINVALID_INPUT;
     }
 
-    drafter_result* result = nullptr;
-
-    drafter_error ret = drafter_parse_blueprint(source, &result, parse_opts);
-
-    if (!result) {
-        return ret;
+    if (!res) {
+        return DRAFTER_EINVALID_OUTPUT;
     }
 
-    drafter_result* out = nullptr;
-
-    refract::FilterVisitor filter(refract::query::Element("annotation"));
-    refract::Iterate<refract::Children> iterate(filter);
-    iterate(*result);
+    drafter_result* result = nullptr;
 
-    if (!filter.empty()) {
-        refract::ArrayElement::ValueType elements;
+    // The parse result holds only the annotations, bodies and schemas are not rendered
+    drafter_error ret
+        = ParseBlueprint(source, &result, ExtendedOptions(parse_opts), drafter::WrapperOptions(false, false, true));
 
-        std::transform(filter.elements().begin(),
-            filter.elements().end(),
-            std::back_inserter(elements),
-            std::bind(&refract::IElement::clone, std::placeholders::_1, refract::IElement::cAll));
+    auto annotations = refract::TypeQueryVisitor::as<const refract::ArrayElement>(result);
 
-        out = new refract::ArrayElement(elements);
-        out->element(drafter::SerializeKey::ParseResult);
+    if (annotations && annotations->get().empty()) {
+        drafter_free_result(result);
+        result = nullptr;
     }
 
-    drafter_free_result(result);
-
-    *res = out;
+    *res = result;
 
     return ret;
 }
@@ -49,6 +49,8 @@ extern "C" {
 #endif
 #endif
 
+#include <stddef.h>
+
 #ifndef __cplusplus
 #include <stdbool.h>
 typedef struct drafter_result drafter_result;
@@ -63,6 +65,53 @@ typedef refract::IElement drafter_result;
 /* Serialization formats, currently only YAML or JSON */
 typedef enum { DRAFTER_SERIALIZE_YAML = 0, DRAFTER_SERIALIZE_JSON } drafter_format;
 
+/* Stages of parsing timed in the parsing statistics */
+typedef enum {
+    DRAFTER_STAGE_MARKDOWN = 0,    /* Markdown parsing */
+    DRAFTER_STAGE_SECTIONS,        /* API Blueprint sections parsing */
+    DRAFTER_STAGE_LAZY_REFERENCES, /* Resolving models referenced before being defined */
+    DRAFTER_STAGE_NAMED_TYPES,     /* Named types registration */
+    DRAFTER_STAGE_MSON,            /* MSON conversion to refract */
+    DRAFTER_STAGE_EXPANSION,       /* MSON expansion */
+    DRAFTER_STAGE_RENDERING,       /* JSON and JSON Schema rendering of message bodies */
+    DRAFTER_STAGE_REFRACT,         /* Remaining conversion to refract */
+    DRAFTER_STAGE_SERIALIZATION,   /* Serialization of the result */
+    DRAFTER_STAGE_COUNT
+} drafter_stage;
+
+/* Components of the parse result selectable in the parsing options
+ * Containers of the selected components are produced too, e.g. resources of the transitions.
+ */
+typedef enum {
+    DRAFTER_COMPONENT_CATEGORIES = 1 << 0,        /* Resource groups */
+    DRAFTER_COMPONENT_RESOURCES = 1 << 1,         /* Resources */
+    DRAFTER_COMPONENT_TRANSITIONS = 1 << 2,       /* Actions with their transactions */
+    DRAFTER_COMPONENT_DATA_STRUCTURES = 1 << 3,   /* Data structures of the Data Structures section */
+    DRAFTER_COMPONENT_GENERATED_BODIES = 1 << 4,  /* Message bodies generated from attributes */
+    DRAFTER_COMPONENT_GENERATED_SCHEMAS = 1 << 5, /* Message body schemas generated from attributes */
+    DRAFTER_COMPONENT_SOURCE_MAPS = 1 << 6,       /* Source maps, also of the annotations of data structures */
+    DRAFTER_COMPONENT_ANNOTATIONS = 1 << 7,       /* Warnings and errors */
+    DRAFTER_COMPONENT_ALL = (1 << 8) - 1
+} drafter_component;
+
+/* Parsing statistics
+ * - stageTime : Wall time of the stages in seconds, a stage excludes the stages it runs
+ * - elementCount : Refract elements of the result, without meta and attributes
+ * - resourceCount, actionCount, dataStructureCount, annotationCount : Elements of the result
+ * - elementsCreated : Refract elements created while parsing, including copies and temporaries
+ * - peakElements : Peak number of refract elements alive while parsing
+ */
+typedef struct {
+    double stageTime[DRAFTER_STAGE_COUNT];
+    unsigned long elementCount;
+    unsigned long resourceCount;
+    unsigned long actionCount;
+    unsigned long dataStructureCount;
+    unsigned long annotationCount;
+    unsigned long elementsCreated;
+    unsigned long peakElements;
+} drafter_parse_stats;
+
 /* Parsing options
  * - requireBlueprintName : API has to have a name, if not it is a parsing error
  */
@@ -70,6 +119,22 @@ typedef struct {
     bool requireBlueprintName;
 } drafter_parse_options;
 
+/* Extended parsing options, taken by the functions with the _ex suffix
+ * - size : sizeof(drafter_parse_options_ex) when the caller was built, options past it are not set
+ * - requireBlueprintName : API has to have a name, if not it is a parsing error
+ * - normalizeSource : Expand tabs and convert CRLF line endings instead of reporting an error
+ * - stats : If not NULL, filled with the statistics of the parsing
+ * - components : Bitwise or of drafter_component to produce in the result, 0 for all of them
+ * New options are only ever appended, callers built with an older version get their defaults.
+ */
+typedef struct {
+    size_t size;
+    bool requireBlueprintName;
+    bool normalizeSource;
+    drafter_parse_stats* stats;
+    unsigned int components;
+} drafter_parse_options_ex;
+
 /* Serialization options
  * - sourcemap : Include sourcemap in the serialized result
  * - format : Serialization format see above
@@ -114,7 +179,12 @@ DRAFTER_API char* drafter_serialize(drafter_result* res, const drafter_serialize
 /* Free memory allocated for result handler */
 DRAFTER_API void drafter_free_result(drafter_result* res);
 
-/* Parse API Blueprint and return only annotations.
+/* Parse API Blueprint and return only annotations, NULL if there are none.
+ * Faster than drafter_parse_blueprint, the API description is not converted,
+ * only the data structures and attributes are, for their warnings. Message
+ * bodies and schemas are not generated from the attributes, so the warnings
+ * of their rendering ("unable to render JSON/JSONSchema") are not reported.
+ * The components option is ignored, all the parts of the blueprint are checked.
  * Returns:
  * - 0 if everything went smooth.
  * - positive numbers if it encountered parsing errors, which are described in the result
@@ -123,6 +193,20 @@ DRAFTER_API void drafter_free_result(drafter_result* res);
 DRAFTER_API drafter_error drafter_check_blueprint(
     const char* source, drafter_result** res, const drafter_parse_options parse_opts);
 
+/* Same as drafter_parse_blueprint_to, drafter_parse_blueprint and drafter_check_blueprint
+ * taking the extended parsing options, NULL for the defaults.
+ */
+DRAFTER_API drafter_error drafter_parse_blueprint_to_ex(const char* source,
+    char** out,
+    const drafter_parse_options_ex* parse_opts,
+    const drafter_serialize_options serialize_opts);
+
+DRAFTER_API drafter_error drafter_parse_blueprint_ex(
+    const char* source, drafter_result** out, const drafter_parse_options_ex* parse_opts);
+
+DRAFTER_API drafter_error drafter_check_blueprint_ex(
+    const char* source, drafter_result** res, const drafter_parse_options_ex* parse_opts);
+
 DRAFTER_API unsigned int drafter_version(void);
 
 DRAFTER_API const char* drafter_version_string(void);
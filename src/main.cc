@@ -22,9 +22,20 @@
 #include "stream.h"
 
 #include "ConversionContext.h"
+#include "StageClock.h"
+#include "Tracing.h"
 
 #include "utils/log/Trivial.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <condition_variable>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 namespace sc = snowcrash;
 
 /**
@@ -51,11 +62,23 @@ void Serialization(std::ostream* stream, const sos::Object& object, sos::Seriali
     *stream << std::flush;
 }
 
-int ProcessRefract(const Config& config, std::unique_ptr<std::istream>& in, std::unique_ptr<std::ostream>& out)
+/**
+ * \brief Parse options read from the command line, the others zero-initialized
+ */
+drafter_parse_options_ex ParseOptions(const Config& config)
 {
-    if(config.enableLog)
-        ENABLE_LOGGING;
+    drafter_parse_options_ex options;
+    memset(&options, 0, sizeof(options));
+
+    options.size = sizeof(options);
+    options.normalizeSource = config.normalize;
+    options.components = config.components;
 
+    return options;
+}
+
+int ProcessRefract(const Config& config, std::unique_ptr<std::istream>& in, std::unique_ptr<std::ostream>& out)
+{
     std::stringstream inputStream;
     inputStream << in->rdbuf();
 
@@ -65,16 +88,23 @@ int ProcessRefract(const Config& config, std::unique_ptr<std::istream>& in, std:
 
     refract::IElement* result = nullptr;
 
-    // TODO: Read parse options from CLI
-    drafter_parse_options parseOptions = { false };
+    drafter_parse_stats stats;
 
-    int ret = drafter_parse_blueprint(inputStream.str().c_str(), &result, parseOptions);
+    drafter_parse_options_ex parseOptions = ParseOptions(config);
+    parseOptions.stats = config.stats ? &stats : nullptr;
 
-    if (!result) {
+    // Validation gets only the annotations, no result when there are none
+    int ret = config.validate ? drafter_check_blueprint_ex(inputStream.str().c_str(), &result, &parseOptions) :
+                                drafter_parse_blueprint_ex(inputStream.str().c_str(), &result, &parseOptions);
+
+    if (!result && (!config.validate || ret < 0)) {
         return -1;
     }
 
     if (!config.validate) { // If not validate, we serialize
+        drafter::StageClock clock(parseOptions.stats);
+        drafter::StageScope stage(clock, DRAFTER_STAGE_SERIALIZATION);
+
         char* output = drafter_serialize(result, options);
 
         if (output) {
@@ -86,18 +116,405 @@ int ProcessRefract(const Config& config, std::unique_ptr<std::istream>& in, std:
 
     PrintReport(result, inputStream.str(), config.lineNumbers, ret);
 
+    if (config.stats) {
+        PrintStats(stats);
+    }
+
     drafter_free_result(result);
 
     return ret;
 }
 
+/**
+ *  \brief Apply the options of a request header to the configuration
+ *
+ *  \return False if there is an unknown option
+ */
+bool ParseRequestOptions(std::istream& header, Config& config, std::string& error)
+{
+    std::string option;
+
+    while (header >> option) {
+        if (option == "json") {
+            config.format = drafter::JSONFormat;
+        } else if (option == "yaml") {
+            config.format = drafter::YAMLFormat;
+        } else if (option == "sourcemap") {
+            config.sourceMap = true;
+        } else if (option == "validate") {
+            config.validate = true;
+        } else if (option == "normalize") {
+            config.normalize = true;
+        } else {
+            error = "unknown request option '" + option + "'";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ *  \brief Parse a blueprint of a request
+ *
+ *  \param output Serialized parse result, or only its annotations while validating
+ *  \return Result of the parsing
+ */
+int ProcessRequest(const Config& config, const std::string& source, std::string& output)
+{
+    drafter_serialize_options options;
+    options.sourcemap = config.sourceMap;
+    options.format = config.format == drafter::YAMLFormat ? DRAFTER_SERIALIZE_YAML : DRAFTER_SERIALIZE_JSON;
+
+    const drafter_parse_options_ex parseOptions = ParseOptions(config);
+
+    refract::IElement* result = nullptr;
+
+    int ret = config.validate ? drafter_check_blueprint_ex(source.c_str(), &result, &parseOptions) :
+                                drafter_parse_blueprint_ex(source.c_str(), &result, &parseOptions);
+
+    if (!result) {
+        return ret;
+    }
+
+    if (char* serialized = drafter_serialize(result, options)) {
+        output = serialized;
+        free(serialized);
+    }
+
+    drafter_free_result(result);
+
+    return ret;
+}
+
+void WriteResponse(std::ostream& out, int status, const std::string& body)
+{
+    out << status << ' ' << body.size() << '\n' << body << std::flush;
+}
+
+/**
+ *  \brief Discard the blueprint of a request without buffering it
+ *
+ *  \return false if the input ends before the blueprint does
+ */
+bool SkipRequest(std::istream& in, unsigned long size)
+{
+    const unsigned long chunk = 64 * 1024;
+
+    while (size > 0) {
+        in.ignore(std::min(size, chunk));
+
+        if (in.gcount() == 0) {
+            return false;
+        }
+
+        size -= in.gcount();
+    }
+
+    return true;
+}
+
+/**
+ *  \brief Answer requests until the end of the input
+ *
+ *  A request is a header line with the length of the blueprint in bytes and
+ *  optional space separated options (json, yaml, sourcemap, validate, normalize)
+ *  overriding the command line ones, followed by the blueprint.
+ *
+ *  A response is a line with the result of the parsing and the length of the
+ *  body in bytes, followed by the body. The body is the serialized parse result,
+ *  or only its annotations while validating. A malformed request, or a request
+ *  longer than the configured maximum, is answered with status -1 and the error
+ *  message as the body.
+ *
+ *  \return EXIT_FAILURE if the input ends in the middle of a request
+ */
+int Serve(const Config& config, std::istream& in, std::ostream& out)
+{
+    std::string header;
+    std::string source;
+    std::string output;
+
+    while (std::getline(in, header)) {
+
+        if (header.empty()) {
+            continue;
+        }
+
+        std::istringstream headerStream(header);
+        std::string length;
+        headerStream >> length;
+
+        char* end = nullptr;
+        unsigned long size = std::strtoul(length.c_str(), &end, 10);
+
+        if (length.empty() || *end != '\0') {
+            WriteResponse(out, -1, "invalid request header '" + header + "'");
+            return EXIT_FAILURE;
+        }
+
+        if (size > config.maxRequestSize) {
+
+            if (!SkipRequest(in, size)) {
+                std::cerr << "fatal: input ended in the middle of a request" << std::endl;
+                return EXIT_FAILURE;
+            }
+
+            std::ostringstream error;
+            error << "request of " << size << " bytes exceeds the maximum of " << config.maxRequestSize << " bytes";
+
+            WriteResponse(out, -1, error.str());
+            continue;
+        }
+
+        source.resize(size);
+        in.read(&source[0], size);
+
+        if (static_cast<unsigned long>(in.gcount()) != size) {
+            std::cerr << "fatal: input ended in the middle of a request" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        Config requestConfig = config;
+        std::string error;
+
+        if (!ParseRequestOptions(headerStream, requestConfig, error)) {
+            WriteResponse(out, -1, error);
+            continue;
+        }
+
+        output.clear();
+        int ret = ProcessRequest(requestConfig, source, output);
+
+        WriteResponse(out, ret, output);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/** Outcome of parsing one of the input files */
+struct BatchResult {
+    bool done = false;
+    int ret = 0;
+    std::string output; // NDJSON line of the file
+    std::string report;
+};
+
+/**
+ *  \brief Minify serialized JSON by dropping the whitespace outside of strings
+ */
+std::string MinifyJSON(const char* json)
+{
+    std::string minified;
+    bool inString = false;
+    bool escaped = false;
+
+    for (const char* c = json; *c; ++c) {
+        if (inString) {
+            if (escaped) {
+                escaped = false;
+            } else if (*c == '\\') {
+                escaped = true;
+            } else if (*c == '"') {
+                inString = false;
+            }
+        } else if (*c == ' ' || *c == '\n' || *c == '\r' || *c == '\t') {
+            continue;
+        } else {
+            inString = *c == '"';
+        }
+
+        minified += *c;
+    }
+
+    return minified;
+}
+
+std::string QuoteJSON(const std::string& text)
+{
+    std::stringstream quoted;
+    quoted << '"';
+
+    for (unsigned char c : text) {
+        if (c == '"' || c == '\\') {
+            quoted << '\\' << c;
+        } else if (c < 0x20) {
+            quoted << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+        } else {
+            quoted << c;
+        }
+    }
+
+    quoted << '"';
+    return quoted.str();
+}
+
+/**
+ *  \brief Parse one of the input files, save its Parse Result and format its report
+ */
+void ProcessBatchInput(const Config& config, const std::string& input, BatchResult& batchResult)
+{
+    std::ifstream inputFileStream(input.c_str(), std::ios_base::in | std::ios_base::binary);
+
+    if (!inputFileStream.is_open()) {
+        batchResult.ret = -1;
+        batchResult.report = "\nfatal: unable to open input file\n";
+        return;
+    }
+
+    std::stringstream inputStream;
+    inputStream << inputFileStream.rdbuf();
+    const std::string source = inputStream.str();
+
+    drafter_serialize_options options;
+    options.sourcemap = config.sourceMap;
+    options.format = config.format == drafter::YAMLFormat && !config.ndjson ? DRAFTER_SERIALIZE_YAML :
+                                                                              DRAFTER_SERIALIZE_JSON;
+
+    const drafter_parse_options_ex parseOptions = ParseOptions(config);
+
+    refract::IElement* result = nullptr;
+
+    batchResult.ret = config.validate ? drafter_check_blueprint_ex(source.c_str(), &result, &parseOptions) :
+                                        drafter_parse_blueprint_ex(source.c_str(), &result, &parseOptions);
+
+    if (!result && (!config.validate || batchResult.ret < 0)) {
+        batchResult.ret = -1;
+        batchResult.report = "\nfatal: unable to parse input file\n";
+        return;
+    }
+
+    std::stringstream report;
+
+    if (!config.validate) {
+        if (char* serialized = drafter_serialize(result, options)) {
+            if (config.ndjson) {
+                batchResult.output = "{\"file\":" + QuoteJSON(input) + ",\"result\":" + MinifyJSON(serialized) + "}\n";
+            } else {
+                std::string outputName = input + (config.format == drafter::YAMLFormat ? ".yaml" : ".json");
+                std::ofstream outputStream(outputName.c_str(), std::ios_base::out | std::ios_base::binary);
+
+                if (!(outputStream << serialized << "\n" << std::flush)) {
+                    report << "\nfatal: unable to write output file '" << outputName << "'";
+                    batchResult.ret = -1;
+                }
+            }
+
+            free(serialized);
+        }
+    }
+
+    PrintReport(report, result, source, config.lineNumbers, batchResult.ret);
+    batchResult.report = report.str();
+
+    drafter_free_result(result);
+}
+
+/**
+ *  \brief Parse the input files concurrently
+ *
+ *  Every input file is parsed by one of `config.jobs` workers. The NDJSON lines
+ *  and the reports are written in the order of the input files as soon as the
+ *  preceding files are done, so the output does not depend on the scheduling.
+ *
+ *  \return Result of the first input file failing to parse, 0 if all of them succeed
+ */
+int ProcessBatch(const Config& config, std::ostream& out)
+{
+    const size_t count = config.inputs.size();
+
+    std::vector<BatchResult> results(count);
+    std::mutex mutex;
+    std::condition_variable done;
+    std::atomic<size_t> next(0);
+
+    auto work = [&]() {
+        for (size_t i = next++; i < count; i = next++) {
+            BatchResult batchResult;
+
+            try {
+                ProcessBatchInput(config, config.inputs[i], batchResult);
+            } catch (const std::exception& e) {
+                batchResult.ret = -1;
+                batchResult.report = std::string("\nfatal: ") + e.what() + "\n";
+            }
+
+            batchResult.done = true;
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                results[i] = std::move(batchResult);
+            }
+
+            done.notify_all();
+        }
+    };
+
+    std::vector<std::thread> workers;
+
+    for (size_t i = 0; i < std::min<size_t>(config.jobs, count); ++i) {
+        workers.emplace_back(work);
+    }
+
+    int ret = 0;
+    size_t failed = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        BatchResult batchResult;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            done.wait(lock, [&]() { return results[i].done; });
+            batchResult = std::move(results[i]);
+        }
+
+        out << batchResult.output << std::flush;
+        std::cerr << config.inputs[i] << ":" << batchResult.report;
+
+        if (batchResult.ret) {
+            ret = ret ? ret : batchResult.ret;
+            ++failed;
+        }
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    std::cerr << std::endl << count << " files, " << failed << " failed" << std::endl;
+
+    return ret;
+}
+
 int main(int argc, const char* argv[])
 {
     Config config;
     ParseCommadLineOptions(argc, argv, config);
 
-    std::unique_ptr<std::istream> in(CreateStreamFromName<std::istream>(config.input));
-    std::unique_ptr<std::ostream> out(CreateStreamFromName<std::ostream>(config.output));
+    if (config.enableLog)
+        ENABLE_LOGGING;
+
+    if (!config.trace.empty())
+        snowcrash::trace::enable();
 
-    return ProcessRefract(config, in, out);
+    int ret = 0;
+
+    if (config.inputs.size() > 1 || config.ndjson) {
+        std::unique_ptr<std::ostream> out(CreateStreamFromName<std::ostream>(config.output));
+        ret = ProcessBatch(config, *out);
+    } else {
+        std::unique_ptr<std::istream> in(CreateStreamFromName<std::istream>(config.input));
+        std::unique_ptr<std::ostream> out(CreateStreamFromName<std::ostream>(config.output));
+
+        ret = config.serve ? Serve(config, *in, *out) : ProcessRefract(config, in, out);
+    }
+
+    if (!config.trace.empty()) {
+        snowcrash::trace::enable(false);
+
+        std::ofstream traceStream(config.trace.c_str());
+        snowcrash::trace::writeChromeTrace(traceStream);
+    }
+
+    return ret;
 }
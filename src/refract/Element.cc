@@ -19,6 +19,14 @@
 
 using namespace refract;
 
+std::atomic<unsigned int> refract::elementCountingScopes{ 0 };
+
+ElementCounters& refract::elementCounters() noexcept
+{
+    static thread_local ElementCounters counters;
+    return counters;
+}
+
 namespace
 {
     constexpr std::array<const char*, 13> reserved_ = {
@@ -15,6 +15,7 @@
 #include "dsd/Traits.h"
 
 #include "ElementIfc.h"
+#include "Hash.h"
 #include "InfoElements.h"
 #include "Visitor.h"
 #include "Utils.h"
@@ -83,6 +84,16 @@ namespace refract
             data_ = data;
         }
 
+        ///
+        /// Compute the structural hash of this Element
+        /// @remark see refract::hash
+        ///
+        std::size_t hash() const noexcept
+        {
+            auto seed = detail::hash_element(name_, !hasValue_, meta_, attributes_);
+            return hasValue_ ? detail::hash_combine(seed, dsd::hash(data_)) : seed;
+        }
+
     public: // IElement
         InfoElements& meta() noexcept override
         {
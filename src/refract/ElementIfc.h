@@ -9,6 +9,8 @@
 #ifndef REFRACT_ELEMENTIFC_H
 #define REFRACT_ELEMENTIFC_H
 
+#include <atomic>
+#include <cstddef>
 #include <string>
 #include <memory>
 
@@ -18,6 +20,69 @@ namespace refract
     class Visitor;
     struct IVisitor; // XXX @tjanc@ experimental
 
+    ///
+    /// Counters of the Elements created and destroyed by the current thread
+    ///
+    struct ElementCounters {
+        std::size_t created = 0;   //< Elements created, including copies
+        std::size_t destroyed = 0; //< Elements destroyed
+        std::ptrdiff_t peak = 0;   //< Peak of the Elements alive
+
+        ///
+        /// Elements alive, negative when this thread destroyed Elements created by another one
+        ///
+        std::ptrdiff_t alive() const noexcept
+        {
+            return static_cast<std::ptrdiff_t>(created - destroyed);
+        }
+    };
+
+    ///
+    /// Query the Element counters of the current thread
+    ///
+    /// The counters only change within an ElementCountingScope.
+    ///
+    /// @return counters of the current thread, modifiable to reset them
+    ///
+    ElementCounters& elementCounters() noexcept;
+
+    ///
+    /// Number of the ElementCountingScope instances alive, in any thread
+    ///
+    extern std::atomic<unsigned int> elementCountingScopes;
+
+    ///
+    /// Query whether the Elements are being counted
+    ///
+    inline bool isCountingElements() noexcept
+    {
+        return elementCountingScopes.load(std::memory_order_relaxed) != 0;
+    }
+
+    ///
+    /// Count the Elements created and destroyed while an instance is alive
+    ///
+    class ElementCountingScope
+    {
+        bool enabled;
+
+    public:
+        explicit ElementCountingScope(bool enabled_ = true) noexcept : enabled(enabled_)
+        {
+            if (enabled)
+                ++elementCountingScopes;
+        }
+
+        ~ElementCountingScope()
+        {
+            if (enabled)
+                --elementCountingScopes;
+        }
+
+        ElementCountingScope(const ElementCountingScope&) = delete;
+        ElementCountingScope& operator=(const ElementCountingScope&) = delete;
+    };
+
     ///
     /// Refract Element interface definition
     ///
@@ -108,7 +173,36 @@ namespace refract
         ///
         virtual bool empty() const = 0;
 
-        virtual ~IElement() = default;
+        virtual ~IElement()
+        {
+            if (isCountingElements())
+                ++elementCounters().destroyed;
+        }
+
+    protected:
+        IElement() noexcept
+        {
+            if (isCountingElements())
+                countCreated();
+        }
+
+        IElement(const IElement&) noexcept
+        {
+            if (isCountingElements())
+                countCreated();
+        }
+
+        IElement& operator=(const IElement&) noexcept = default;
+
+    private:
+        static void countCreated() noexcept
+        {
+            ElementCounters& counters = elementCounters();
+            ++counters.created;
+
+            if (counters.alive() > counters.peak)
+                counters.peak = counters.alive();
+        }
     };
 
     ///
@@ -104,15 +104,12 @@ namespace refract
         std::unique_ptr<ExtendElement> GetInheritanceTree(const std::string& name, const Registry& registry)
         {
             std::stack<std::unique_ptr<IElement> > inheritance;
-            std::string en = name;
 
-            // FIXME: add check against recursive inheritance
-            // walk recursive in registry and expand inheritance tree
-            for (const IElement *parent = registry.find(en); parent && !isReserved(en);
-                 en = parent->element(), parent = registry.find(en)) {
+            // walk registered ancestors and expand inheritance tree
+            for (Registry::Handle parent = registry.handle(name); parent; parent = registry.parent(parent)) {
 
-                inheritance.push(clone(*parent, ((IElement::cAll ^ IElement::cElement) | IElement::cNoMetaId)));
-                inheritance.top()->meta().set("ref", from_primitive(en));
+                inheritance.push(clone(*parent->element, ((IElement::cAll ^ IElement::cElement) | IElement::cNoMetaId)));
+                inheritance.top()->meta().set("ref", from_primitive(parent->id));
             }
 
             if (inheritance.empty())
@@ -0,0 +1,126 @@
+//
+//  refract/Hash.cc
+//  librefract
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#include "Hash.h"
+
+#include <functional>
+
+#include "Element.h"
+
+using namespace refract;
+
+namespace
+{
+    template <typename Container>
+    std::size_t hashSequence(std::size_t seed, const Container& elements) noexcept
+    {
+        for (const auto& el : elements)
+            seed = detail::hash_combine(seed, el ? refract::hash(*el) : 0);
+        return seed;
+    }
+
+    std::size_t hashName(const char* name) noexcept
+    {
+        return std::hash<std::string>{}(name);
+    }
+}
+
+std::size_t refract::hash(const IElement& el) noexcept
+{
+    return visit(el, [](const auto& e) { return e.hash(); });
+}
+
+std::size_t refract::hash(const InfoElements& info) noexcept
+{
+    // summing makes the result independent of entry order
+    std::size_t result = 0;
+    for (const auto& entry : info) {
+        if (entry.first == "sourceMap")
+            continue;
+
+        result += detail::hash_combine(
+            std::hash<std::string>{}(entry.first), entry.second ? refract::hash(*entry.second) : 0);
+    }
+    return result;
+}
+
+std::size_t detail::hash_element(
+    const std::string& name, bool empty, const InfoElements& meta, const InfoElements& attributes) noexcept
+{
+    std::size_t seed = std::hash<std::string>{}(name);
+    seed = hash_combine(seed, empty ? 0 : 1);
+    seed = hash_combine(seed, refract::hash(meta));
+    return hash_combine(seed, refract::hash(attributes));
+}
+
+std::size_t dsd::hash(const Null&) noexcept
+{
+    return hashName(Null::name);
+}
+
+std::size_t dsd::hash(const String& s) noexcept
+{
+    return std::hash<std::string>{}(s.get());
+}
+
+std::size_t dsd::hash(const Boolean& b) noexcept
+{
+    return detail::hash_combine(hashName(Boolean::name), b.get() ? 1 : 0);
+}
+
+std::size_t dsd::hash(const Number& n) noexcept
+{
+    // 0.0 == -0.0, hash both as 0
+    const double value = n.get();
+    return value == 0 ? 0 : std::hash<double>{}(value);
+}
+
+std::size_t dsd::hash(const Ref& r) noexcept
+{
+    return detail::hash_combine(hashName(Ref::name), std::hash<std::string>{}(r.symbol()));
+}
+
+std::size_t dsd::hash(const Holder& h) noexcept
+{
+    return h.data() ? refract::hash(*h.data()) : 0;
+}
+
+std::size_t dsd::hash(const Member& m) noexcept
+{
+    std::size_t seed = m.key() ? refract::hash(*m.key()) : 0;
+    return detail::hash_combine(seed, m.value() ? refract::hash(*m.value()) : 0);
+}
+
+std::size_t dsd::hash(const Array& a) noexcept
+{
+    return hashSequence(hashName(Array::name), a);
+}
+
+std::size_t dsd::hash(const Enum& e) noexcept
+{
+    return detail::hash_combine(hashName(Enum::name), e.value() ? refract::hash(*e.value()) : 0);
+}
+
+std::size_t dsd::hash(const Object& o) noexcept
+{
+    return hashSequence(hashName(Object::name), o);
+}
+
+std::size_t dsd::hash(const Extend& e) noexcept
+{
+    return hashSequence(hashName(Extend::name), e);
+}
+
+std::size_t dsd::hash(const Option& o) noexcept
+{
+    return hashSequence(hashName(Option::name), o);
+}
+
+std::size_t dsd::hash(const Select& s) noexcept
+{
+    return hashSequence(hashName(Select::name), s);
+}
@@ -0,0 +1,73 @@
+//
+//  refract/Hash.h
+//  librefract
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#ifndef REFRACT_HASH_H
+#define REFRACT_HASH_H
+
+#include <cstddef>
+#include <string>
+
+#include "ElementFwd.h"
+
+namespace refract
+{
+    struct IElement;
+    class InfoElements;
+
+    ///
+    /// Structural hash of an Element
+    ///
+    /// Consistent with both `operator==` on Elements and drafter::Equal with
+    /// its default ignore predicates: `sourceMap` entries are not hashed and
+    /// the order of meta and attribute entries does not matter.
+    ///
+    /// @remark equal hashes do not imply equal Elements, different hashes
+    ///     imply different Elements; use it to skip full comparisons
+    ///
+    std::size_t hash(const IElement& el) noexcept;
+
+    ///
+    /// Order insensitive structural hash of meta or attributes,
+    /// `sourceMap` entries are not hashed
+    ///
+    std::size_t hash(const InfoElements& info) noexcept;
+
+    namespace dsd
+    {
+        std::size_t hash(const Null&) noexcept;
+        std::size_t hash(const String&) noexcept;
+        std::size_t hash(const Boolean&) noexcept;
+        std::size_t hash(const Number&) noexcept;
+        std::size_t hash(const Ref&) noexcept;
+        std::size_t hash(const Holder&) noexcept;
+        std::size_t hash(const Member&) noexcept;
+        std::size_t hash(const Array&) noexcept;
+        std::size_t hash(const Enum&) noexcept;
+        std::size_t hash(const Object&) noexcept;
+        std::size_t hash(const Extend&) noexcept;
+        std::size_t hash(const Option&) noexcept;
+        std::size_t hash(const Select&) noexcept;
+    }
+
+    namespace detail
+    {
+        ///
+        /// Mix `value` into `seed`
+        ///
+        inline std::size_t hash_combine(std::size_t seed, std::size_t value) noexcept
+        {
+            return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+        }
+
+        std::size_t hash_element(const std::string& name,
+            bool empty,
+            const InfoElements& meta,
+            const InfoElements& attributes) noexcept;
+    }
+}
+
+#endif
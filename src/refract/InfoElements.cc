@@ -10,13 +10,38 @@
 
 #include <cassert>
 #include <algorithm>
+#include <functional>
 #include "Element.h"
 #include "dsd/ElementData.h"
 #include "TypeQueryVisitor.h"
 
+namespace
+{
+    constexpr std::size_t MinIndexCapacity = 32;
+
+    std::size_t hashKey(const std::string& key)
+    {
+        return std::hash<std::string>{}(key);
+    }
+
+    template <typename Index>
+    void placeInIndex(Index& index, const std::string& key, std::size_t position)
+    {
+        const std::size_t mask = index.size() - 1;
+
+        std::size_t slot = hashKey(key) & mask;
+        while (index[slot] != 0)
+            slot = (slot + 1) & mask;
+
+        index[slot] = static_cast<typename Index::value_type>(position + 1);
+    }
+}
+
 namespace refract
 {
-    InfoElements::InfoElements() : elements() {}
+    constexpr std::size_t InfoElements::IndexThreshold;
+
+    InfoElements::InfoElements() : elements(), index() {}
 
     InfoElements::InfoElements(InfoElements&& other) : InfoElements()
     {
@@ -52,11 +77,13 @@ namespace refract
     void InfoElements::erase(iterator it)
     {
         elements.erase(it);
+        reindex();
     }
 
     void InfoElements::clear()
     {
         elements.clear();
+        index.clear();
     }
 
     bool InfoElements::empty() const noexcept
@@ -69,13 +96,14 @@ namespace refract
         return elements.size();
     }
 
-    InfoElements::InfoElements(const InfoElements& other) : elements()
+    InfoElements::InfoElements(const InfoElements& other) : elements(), index()
     {
         elements.reserve(other.size());
         std::transform(other.begin(), other.end(), std::back_inserter(elements), [](const auto& el) {
             assert(el.second);
             return std::make_pair(el.first, refract::clone(*el.second));
         });
+        reindex();
     }
 
     void InfoElements::clone(const InfoElements& other)
@@ -84,25 +112,30 @@ namespace refract
             assert(el.second);
             return std::make_pair(el.first, refract::clone(*el.second));
         });
+        reindex();
     }
 
     void InfoElements::erase(const std::string& key)
     {
-        elements.erase(
-            std::remove_if(
-                elements.begin(), elements.end(), [&key](const auto& keyValue) { return keyValue.first == key; }),
-            elements.end());
+        auto last = std::remove_if(
+            elements.begin(), elements.end(), [&key](const auto& keyValue) { return keyValue.first == key; });
+
+        if (last != elements.end()) {
+            elements.erase(last, elements.end());
+            reindex();
+        }
     }
 
     IElement& InfoElements::set(const std::string& key, std::unique_ptr<IElement> value)
     {
         auto& valueRef = *value;
 
-        auto it = find(key);
-        if (it == end())
+        auto position = lookup(key);
+        if (position == elements.size()) {
             elements.emplace_back(key, std::move(value));
-        else
-            it->second = std::move(value);
+            indexInsert(position);
+        } else
+            elements[position].second = std::move(value);
 
         return valueRef;
     }
@@ -125,19 +158,64 @@ namespace refract
     {
         std::unique_ptr<IElement> result(it->second.release());
         elements.erase(it);
+        reindex();
 
         return result;
     }
 
     InfoElements::const_iterator InfoElements::find(const std::string& name) const
     {
-        return std::find_if(
-            elements.begin(), elements.end(), [&name](const auto& keyValue) { return keyValue.first == name; });
+        return elements.begin() + lookup(name);
     }
 
     InfoElements::iterator InfoElements::find(const std::string& name)
     {
-        return std::find_if(
-            elements.begin(), elements.end(), [&name](const auto& keyValue) { return keyValue.first == name; });
+        return elements.begin() + lookup(name);
+    }
+
+    InfoElements::Container::size_type InfoElements::lookup(const std::string& name) const
+    {
+        if (index.empty()) {
+            auto it = std::find_if(
+                elements.begin(), elements.end(), [&name](const auto& keyValue) { return keyValue.first == name; });
+            return it - elements.begin();
+        }
+
+        const std::size_t mask = index.size() - 1;
+        for (std::size_t slot = hashKey(name) & mask; index[slot] != 0; slot = (slot + 1) & mask) {
+            const auto position = index[slot] - 1;
+            if (elements[position].first == name)
+                return position;
+        }
+
+        return elements.size();
+    }
+
+    void InfoElements::indexInsert(Container::size_type position)
+    {
+        // grow (or build) the index to keep the load factor at most 1/2
+        if (elements.size() * 2 > index.size()) {
+            reindex();
+            return;
+        }
+
+        placeInIndex(index, elements[position].first, position);
+    }
+
+    void InfoElements::reindex()
+    {
+        if (elements.size() <= IndexThreshold) {
+            Index().swap(index);
+            return;
+        }
+
+        std::size_t capacity = MinIndexCapacity;
+        while (capacity < elements.size() * 2)
+            capacity <<= 1;
+
+        index.assign(capacity, 0);
+
+        for (Container::size_type position = 0; position < elements.size(); ++position)
+            placeInIndex(index, elements[position].first, position);
     }
 }
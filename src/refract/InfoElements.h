@@ -9,6 +9,7 @@
 #ifndef REFRACT_INFO_ELEMENTS_H
 #define REFRACT_INFO_ELEMENTS_H
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -17,10 +18,23 @@
 
 namespace refract
 {
+    ///
+    /// Insertion ordered collection of keyed elements (meta, attributes)
+    ///
+    /// Lookup is a linear scan for small collections. Once the collection
+    /// grows above `IndexThreshold` entries, an open addressing hash index
+    /// (linear probing) into `elements` is maintained alongside.
+    ///
     class InfoElements final
     {
         using Container = std::vector<std::pair<std::string, std::unique_ptr<IElement> > >;
+        using Index = std::vector<std::uint32_t>; // position + 1; 0 marks an empty slot
+
         Container elements;
+        Index index;
+
+    public:
+        static constexpr std::size_t IndexThreshold = 8;
 
     public:
         using iterator = typename Container::iterator;
@@ -41,6 +55,7 @@ namespace refract
         {
             using std::swap;
             swap(lhs.elements, rhs.elements);
+            swap(lhs.index, rhs.index);
         }
 
     public:
@@ -72,6 +87,12 @@ namespace refract
         bool empty() const noexcept;
 
         Container::size_type size() const noexcept;
+
+    private:
+        Container::size_type lookup(const std::string& name) const;
+
+        void indexInsert(Container::size_type position);
+        void reindex();
     };
 }
 
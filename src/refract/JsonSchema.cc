@@ -11,6 +11,7 @@
 #include "../ElementData.h"
 #include "../utils/log/Trivial.h"
 #include "../utils/so/JsonIo.h"
+#include "Tracing.h"
 #include "Element.h"
 #include "ElementUtils.h"
 #include "Utils.h"
@@ -331,6 +332,8 @@ namespace
 
 so::Object schema::generateJsonSchema(const IElement& el)
 {
+    TRACE_SPAN_DETAIL("generateJsonSchema", el.element());
+
     so::Object result{};
 
     addSchemaVersion(result);
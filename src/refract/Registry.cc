@@ -13,24 +13,27 @@
 #include "SerializeCompactVisitor.h"
 #include "TypeQueryVisitor.h"
 #include <algorithm>
+#include <cstdint>
 
 using namespace refract;
 
-const IElement* refract::FindRootAncestor(const std::string& name, const Registry& registry)
+const IElement* refract::FindRootAncestor(boost::string_view name, const Registry& registry)
 {
-    const IElement* parent = registry.find(name);
-
-    while (parent && !isReserved(parent->element())) {
-        const IElement* next = registry.find(parent->element());
+    Registry::Handle root = registry.root(registry.handle(name));
+    return root ? root->element.get() : nullptr;
+}
 
-        if (!next || (next == parent)) {
-            return parent;
-        }
+std::size_t Registry::Hash::operator()(boost::string_view name) const noexcept
+{
+    // FNV-1a, hashes the viewed characters without copying them into a std::string
+    std::uint64_t hash = 14695981039346656037ull;
 
-        parent = next;
+    for (char c : name) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
     }
 
-    return parent;
+    return static_cast<std::size_t>(hash);
 }
 
 std::string Registry::getElementId(IElement& element)
@@ -52,7 +55,33 @@ std::string Registry::getElementId(IElement& element)
     throw LogicError("Value of element meta 'id' is not StringElement");
 }
 
-const IElement* Registry::find(const std::string& name) const
+void Registry::resolve(const Entry& entry) const
+{
+    if (entry.generation == generation) {
+        return;
+    }
+
+    // mark as resolved first, it ends the walk on recursive inheritance
+    entry.generation = generation;
+    entry.root = &entry;
+
+    const std::string& parentId = entry.element->element();
+
+    entry.parent = isReserved(parentId) ? nullptr : handle(parentId);
+    if (entry.parent == &entry) {
+        entry.parent = nullptr;
+    }
+
+    if (entry.parent) {
+        entry.root = root(entry.parent);
+    }
+
+    TypeQueryVisitor query;
+    VisitBy(*entry.root->element, query);
+    entry.baseType = query.get();
+}
+
+Registry::Handle Registry::handle(boost::string_view name) const
 {
     auto i = registrated.find(name);
 
@@ -63,6 +92,42 @@ const IElement* Registry::find(const std::string& name) const
     return i->second.get();
 }
 
+const IElement* Registry::find(boost::string_view name) const
+{
+    Handle entry = handle(name);
+    return entry ? entry->element.get() : nullptr;
+}
+
+Registry::Handle Registry::parent(Handle entry) const
+{
+    if (!entry) {
+        return nullptr;
+    }
+
+    resolve(*entry);
+    return entry->parent;
+}
+
+Registry::Handle Registry::root(Handle entry) const
+{
+    if (!entry) {
+        return nullptr;
+    }
+
+    resolve(*entry);
+    return entry->root;
+}
+
+TypeQueryVisitor::ElementType Registry::baseType(Handle entry) const
+{
+    if (!entry) {
+        return TypeQueryVisitor::Unknown;
+    }
+
+    resolve(*entry);
+    return entry->baseType;
+}
+
 bool Registry::add(std::unique_ptr<IElement> element)
 {
     assert(element);
@@ -84,11 +149,18 @@ bool Registry::add(std::unique_ptr<IElement> element)
         return false;
     }
 
-    registrated[id] = std::move(element);
+    std::unique_ptr<Entry> entry = std::make_unique<Entry>();
+    entry->id = std::move(id);
+    entry->element = std::move(element);
+
+    boost::string_view key = entry->id;
+    registrated.emplace(key, std::move(entry));
+
+    ++generation;
     return true;
 }
 
-bool Registry::remove(const std::string& name)
+bool Registry::remove(boost::string_view name)
 {
     auto i = registrated.find(name);
 
@@ -97,10 +169,13 @@ bool Registry::remove(const std::string& name)
     }
 
     registrated.erase(i);
+
+    ++generation;
     return true;
 }
 
 void Registry::clearAll(bool releaseElements)
 {
     registrated.clear();
+    ++generation;
 }
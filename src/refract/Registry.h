@@ -8,30 +8,87 @@
 #ifndef REFRACT_REGISTRY_H
 #define REFRACT_REGISTRY_H
 
-#include <map>
+#include <cstdint>
 #include <string>
 #include <memory>
+#include <unordered_map>
+
+#include <boost/utility/string_view.hpp>
 
 #include "ElementIfc.h"
+#include "TypeQueryVisitor.h"
 
 namespace refract
 {
     class Registry
     {
-        typedef std::map<std::string, std::unique_ptr<IElement> > Map;
+    public:
+        ///
+        /// Registered named type
+        ///
+        /// Links to the parent and root ancestor are resolved lazily and
+        /// cached until the registry is modified.
+        ///
+        struct Entry {
+            std::string id;
+            std::unique_ptr<IElement> element;
+
+        private:
+            friend class Registry;
+
+            mutable std::uint64_t generation = 0; //< generation of cached links
+            mutable const Entry* parent = nullptr;
+            mutable const Entry* root = nullptr;
+            mutable TypeQueryVisitor::ElementType baseType = TypeQueryVisitor::Unknown;
+        };
+
+        ///
+        /// Stable reference to a registered named type
+        ///
+        /// @remark valid until the named type is removed or the registry cleared
+        ///
+        using Handle = const Entry*;
+
+    private:
+        struct Hash {
+            std::size_t operator()(boost::string_view name) const noexcept;
+        };
+
+        // keys view the ids owned by entries
+        typedef std::unordered_map<boost::string_view, std::unique_ptr<Entry>, Hash> Map;
         Map registrated;
 
+        std::uint64_t generation = 1;
+
         std::string getElementId(IElement& element);
 
+        void resolve(const Entry& entry) const;
+
     public:
-        const IElement* find(const std::string& name) const;
+        Handle handle(boost::string_view name) const;
+        const IElement* find(boost::string_view name) const;
+
+        ///
+        /// Registered named type the given one directly inherits from
+        ///
+        Handle parent(Handle entry) const;
+
+        ///
+        /// Top most registered ancestor of the given named type
+        ///
+        Handle root(Handle entry) const;
+
+        ///
+        /// Type of the top most registered ancestor of the given named type
+        ///
+        TypeQueryVisitor::ElementType baseType(Handle entry) const;
 
         bool add(std::unique_ptr<IElement> element);
-        bool remove(const std::string& name);
+        bool remove(boost::string_view name);
         void clearAll(bool releaseElements = false);
     };
 
-    const IElement* FindRootAncestor(const std::string& name, const Registry& registry);
+    const IElement* FindRootAncestor(boost::string_view name, const Registry& registry);
 
 } // namespace refract
 
@@ -9,6 +9,7 @@
 #include "reporting.h"
 
 #include <algorithm>
+#include <iomanip>
 #include <iostream>
 
 #include "refract/Element.h"
@@ -259,18 +260,67 @@ void PrintReport(const snowcrash::Report& report, const std::string& source, con
 
 void PrintReport(const drafter_result* result, const std::string& source, const bool useLineNumbers, const int error)
 {
-    std::cerr << std::endl;
+    PrintReport(std::cerr, result, source, useLineNumbers, error);
+}
+
+void PrintReport(std::ostream& out,
+    const drafter_result* result,
+    const std::string& source,
+    const bool useLineNumbers,
+    const int error)
+{
+    out << std::endl;
 
     FilterVisitor filter(query::Element("annotation"));
     Iterate<Children> iterate(filter);
-    iterate(*result);
+
+    if (result) {
+        iterate(*result);
+    }
 
     if (error == sc::Error::OK) {
-        std::cerr << "OK.\n";
+        out << "OK.\n";
     }
 
     std::transform(filter.elements().begin(),
         filter.elements().end(),
-        std::ostream_iterator<std::string>(std::cerr, "\n"),
+        std::ostream_iterator<std::string>(out, "\n"),
         AnnotationToString(source, useLineNumbers));
 }
+
+void PrintStats(const drafter_parse_stats& stats)
+{
+    static const char* const stageNames[DRAFTER_STAGE_COUNT] = {
+        "markdown",        //
+        "sections",        //
+        "lazy references", //
+        "named types",     //
+        "mson",            //
+        "expansion",       //
+        "rendering",       //
+        "refract",         //
+        "serialization",   //
+    };
+
+    double total = 0;
+
+    std::cerr << std::endl << "stage times:" << std::endl;
+
+    for (int stage = 0; stage < DRAFTER_STAGE_COUNT; ++stage) {
+        std::cerr << "  " << std::left << std::setw(20) << stageNames[stage] << std::right << std::fixed
+                  << std::setprecision(6) << stats.stageTime[stage] << " s" << std::endl;
+        total += stats.stageTime[stage];
+    }
+
+    std::cerr << "  " << std::left << std::setw(20) << "total" << std::right << total << " s" << std::endl;
+    std::cerr.unsetf(std::ios_base::floatfield);
+
+    std::cerr << "counts:" << std::endl;
+    std::cerr << "  " << std::left << std::setw(20) << "resources" << stats.resourceCount << std::endl;
+    std::cerr << "  " << std::setw(20) << "actions" << stats.actionCount << std::endl;
+    std::cerr << "  " << std::setw(20) << "data structures" << stats.dataStructureCount << std::endl;
+    std::cerr << "  " << std::setw(20) << "annotations" << stats.annotationCount << std::endl;
+    std::cerr << "  " << std::setw(20) << "elements" << stats.elementCount << std::endl;
+    std::cerr << "  " << std::setw(20) << "elements created" << stats.elementsCreated << std::endl;
+    std::cerr << "  " << std::setw(20) << "peak elements" << stats.peakElements << std::right << std::endl;
+}
@@ -9,6 +9,8 @@
 #ifndef DRAFTER_REPORTING_H
 #define DRAFTER_REPORTING_H
 
+#include <ostream>
+
 #include "drafter.h"
 #include "SourceAnnotation.h"
 
@@ -31,4 +33,26 @@ void PrintReport(const snowcrash::Report& report, const std::string& source, con
  */
 void PrintReport(const drafter_result*, const std::string& source, const bool useLineNumbers, const int error);
 
+/**
+ *  \brief Print parser report to a stream.
+ *
+ *  \param out Stream to print the report to
+ *  \param report A parser report to print, NULL if there are no annotations
+ *  \param source Source data
+ *  \param useLineNumbers True if the annotations needs to be printed by line and column number
+ *  \param error - code form parsing
+ */
+void PrintReport(std::ostream& out,
+    const drafter_result*,
+    const std::string& source,
+    const bool useLineNumbers,
+    const int error);
+
+/**
+ *  \brief Print parsing statistics to stderr.
+ *
+ *  \param stats Statistics of the parsing
+ */
+void PrintStats(const drafter_parse_stats& stats);
+
 #endif // #ifndef DRAFTER_REPORTING_H
@@ -8,17 +8,147 @@
 
 #include "Trivial.h"
 
+#include <algorithm>
+#include <chrono>
+
 using namespace drafter;
 using namespace utils;
 using namespace log;
 
+namespace
+{
+    /// Longest wait of an entry for the writer
+    const std::chrono::milliseconds FlushInterval(100);
+
+    /// Size of the entries queued by a thread waking the writer before the interval elapses
+    const size_t FlushThreshold = 64 * 1024;
+
+    std::atomic<size_t> nextLogId(0);
+}
+
+std::atomic<bool> trivial_log::enabled_(false);
+
 trivial_log& trivial_log::instance()
 {
     static trivial_log instance_{"drafter.log"};
     return instance_;
 }
 
-trivial_log::trivial_log(const char* file) : out_(file), enabled_(false) {
+trivial_log::trivial_log(const char* file) : id_(nextLogId++), out_(file) {}
+
+trivial_log::~trivial_log()
+{
+    enabled_.store(false, std::memory_order_relaxed);
+
+    {
+        std::lock_guard<std::mutex> lock(writer_mtx_);
+        stop_ = true;
+    }
+
+    wake_.notify_one();
+
+    if (writer_.joinable())
+        writer_.join();
+    else
+        drain();
+}
+
+void trivial_log::enable()
+{
+    start();
+    enabled_.store(true, std::memory_order_relaxed);
+}
+
+void trivial_log::start()
+{
+    std::lock_guard<std::mutex> lock(writer_mtx_);
+
+    if (!writer_.joinable())
+        writer_ = std::thread(&trivial_log::run, this);
+}
+
+trivial_log::buffer& trivial_log::thread_buffer()
+{
+    typedef std::pair<size_t, std::shared_ptr<buffer> > cached_buffer;
+    static thread_local std::vector<cached_buffer> cached;
+
+    for (const cached_buffer& c : cached)
+        if (c.first == id_)
+            return *c.second;
+
+    // Buffers no longer held by their logs belong to destroyed logs
+    cached.erase(std::remove_if(cached.begin(),
+                     cached.end(),
+                     [](const cached_buffer& c) { return c.second.use_count() == 1; }),
+        cached.end());
+
+    auto b = std::make_shared<buffer>();
+
+    {
+        std::lock_guard<std::mutex> lock(buffers_mtx_);
+        buffers_.push_back(b);
+    }
+
+    cached.emplace_back(id_, b);
+    return *b;
+}
+
+void trivial_log::write(const std::string& entry)
+{
+    buffer& b = thread_buffer();
+    size_t size;
+
+    {
+        std::lock_guard<std::mutex> lock(b.mtx);
+        b.data += entry;
+        size = b.data.size();
+    }
+
+    // A missed wake up only delays the entries until the interval elapses
+    if (size >= FlushThreshold && size - entry.size() < FlushThreshold)
+        wake_.notify_one();
+}
+
+void trivial_log::flush()
+{
+    std::lock_guard<std::mutex> lock(writer_mtx_);
+    drain();
+}
+
+void trivial_log::run()
+{
+    std::unique_lock<std::mutex> lock(writer_mtx_);
+
+    while (!stop_) {
+        wake_.wait_for(lock, FlushInterval);
+        drain();
+    }
+
+    drain();
+}
+
+void trivial_log::drain()
+{
+    std::lock_guard<std::mutex> lock(buffers_mtx_);
+
+    for (auto i = buffers_.begin(); i != buffers_.end();) {
+        spare_.clear();
+
+        {
+            std::lock_guard<std::mutex> bufferLock((*i)->mtx);
+            spare_.swap((*i)->data);
+        }
+
+        out_ << spare_;
+
+        // Only the log holds the buffer of a finished thread
+        if (i->use_count() == 1)
+            i = buffers_.erase(i);
+        else
+            ++i;
+    }
+
+    out_ << std::flush;
 }
 
 const char* log::severity_to_str(severity s)
@@ -9,14 +9,33 @@
 #ifndef DRAFTER_UTILS_LOG_TRIVIAL_H
 #define DRAFTER_UTILS_LOG_TRIVIAL_H
 
+#include <atomic>
+#include <condition_variable>
 #include <fstream>
+#include <memory>
 #include <mutex>
+#include <sstream>
+#include <string>
 #include <thread>
+#include <vector>
+
+/// Least severity compiled in, entries of lower severities are removed at compile time
+#ifndef LOG_MIN_SEVERITY
+#ifdef DEBUG
+#define LOG_MIN_SEVERITY debug
+#else
+#define LOG_MIN_SEVERITY info
+#endif
+#endif
 
 #define ENABLE_LOGGING (drafter::utils::log::trivial_log::instance().enable())
 
 // clang-format off
-#define LOG(svrty) (drafter::utils::log::trivial_entry<drafter::utils::log::svrty>{ drafter::utils::log::trivial_log::instance(), __LINE__, __FILE__ })
+#define LOG(svrty)                                                                                                     \
+    !drafter::utils::log::trivial_log::enabled<drafter::utils::log::svrty>()                                           \
+        ? (void)0                                                                                                      \
+        : drafter::utils::log::trivial_voidify() &                                                                     \
+            drafter::utils::log::trivial_entry<drafter::utils::log::svrty>{ drafter::utils::log::trivial_log::instance(), __LINE__, __FILE__ }
 // clang-format on
 
 namespace drafter
@@ -33,40 +52,84 @@ namespace drafter
                 error,
             };
 
+            constexpr severity min_severity = LOG_MIN_SEVERITY;
+
             const char* severity_to_str(severity s);
 
+            ///
+            /// Log written by a background thread
+            ///
+            /// Every logging thread appends formatted entries to a buffer of its own, the
+            /// writer collects the buffers and writes them into the log file periodically
+            /// or once a buffer grows large enough. Entries of a thread keep their order,
+            /// entries of different threads are only ordered within a flush.
+            ///
             class trivial_log
             {
-                mutable std::mutex write_mtx_;
+                /// Entries of a thread waiting for the writer
+                struct buffer {
+                    std::mutex mtx;
+                    std::string data;
+                };
+
+                static std::atomic<bool> enabled_;
+
+                /// Identifies the log in the buffers cached by the threads
+                const size_t id_;
+
                 std::ofstream out_;
-                bool enabled_ = false;
+
+                /// Buffers of the logging threads
+                std::vector<std::shared_ptr<buffer> > buffers_;
+                std::mutex buffers_mtx_;
+
+                /// Drained buffer, swapped with the buffers to keep their capacity
+                std::string spare_;
+
+                std::mutex writer_mtx_;
+                std::condition_variable wake_;
+                std::thread writer_;
+                bool stop_ = false;
 
             public:
                 static trivial_log& instance();
 
-            private:
-                trivial_log(const char* out_path);
+                explicit trivial_log(const char* out_path);
+                ~trivial_log();
 
-            public:
-                std::mutex& mtx() const
-                {
-                    return write_mtx_;
-                }
+                trivial_log(const trivial_log&) = delete;
+                trivial_log& operator=(const trivial_log&) = delete;
 
-                std::ostream& out()
-                {
-                    return out_;
-                }
+                /// Start the writer and accept entries
+                void enable();
 
-                void enable()
+                /// Start the writer without enabling the LOG macro
+                void start();
+
+                /// \returns True if entries of the severity are logged, a single relaxed load at run time
+                template <severity SEVERITY>
+                static bool enabled() noexcept
                 {
-                    std::lock_guard<std::mutex> lock(write_mtx_);
-                    enabled_ = true;
+                    return SEVERITY >= min_severity && enabled_.load(std::memory_order_relaxed);
                 }
 
-                bool enabled() const noexcept
+                /// Queue a formatted entry, only waits for the writer taking the buffer of the thread
+                void write(const std::string& entry);
+
+                /// Write the queued entries into the log file
+                void flush();
+
+            private:
+                buffer& thread_buffer();
+                void run();
+                void drain();
+            };
+
+            /// Discards the entry a LOG statement evaluates to, the `&` binds looser than `<<`
+            struct trivial_voidify {
+                template <typename Entry>
+                void operator&(const Entry&) const noexcept
                 {
-                    return enabled_;
                 }
             };
 
@@ -74,16 +137,39 @@ namespace drafter
             class trivial_entry
             {
                 trivial_log& log_;
-                std::lock_guard<std::mutex> log_lock_;
+                std::ostringstream* line_;
+                std::unique_ptr<std::ostringstream> own_;
+
+                /// \returns Stream reused by the entries of the current thread, nullptr if already in use
+                static std::ostringstream* thread_line(bool acquire) noexcept
+                {
+                    static thread_local std::ostringstream line;
+                    static thread_local bool busy = false;
+
+                    if (!acquire) {
+                        busy = false;
+                        return nullptr;
+                    }
+
+                    if (busy)
+                        return nullptr;
+
+                    busy = true;
+                    line.str(std::string());
+                    return &line;
+                }
 
             public:
-                trivial_entry(trivial_log& log, size_t line, const char* file) : log_(log), log_lock_(log_.mtx())
+                trivial_entry(trivial_log& log, size_t line, const char* file) : log_(log), line_(thread_line(true))
                 {
-                    if (log.enabled()) {
-                        log_.out() << '[' << severity_to_str(SEVERITY) << "]";
-                        log_.out() << '[' << std::this_thread::get_id() << "]";
-                        log_.out() << '[' << file << ':' << line << "] ";
+                    if (!line_) { // nested entry, e.g. logged while formatting another one
+                        own_.reset(new std::ostringstream);
+                        line_ = own_.get();
                     }
+
+                    *line_ << '[' << severity_to_str(SEVERITY) << "]";
+                    *line_ << '[' << std::this_thread::get_id() << "]";
+                    *line_ << '[' << file << ':' << line << "] ";
                 }
 
                 trivial_entry(const trivial_entry&) = delete;
@@ -94,33 +180,20 @@ namespace drafter
 
                 ~trivial_entry()
                 {
-                    if (log_.enabled())
-                        log_.out() << '\n'; // TODO @tjanc@ could throw
-                }
+                    *line_ << '\n';
+                    log_.write(line_->str()); // TODO @tjanc@ could throw
 
-                template <typename T>
-                trivial_entry& operator<<(T&& obj)
-                {
-                    if (log_.enabled())
-                        log_.out() << std::forward<T>(obj);
-                    return *this;
+                    if (!own_)
+                        thread_line(false);
                 }
-            };
-
-#ifndef DEBUG
-            template <>
-            class trivial_entry<debug>
-            {
-            public:
-                constexpr trivial_entry(trivial_log& log, size_t line, const char* file) noexcept {}
 
                 template <typename T>
-                const trivial_entry<debug>& operator<<(T&& obj) const noexcept
+                trivial_entry& operator<<(T&& obj)
                 {
+                    *line_ << std::forward<T>(obj);
                     return *this;
                 }
             };
-#endif
         }
     }
 }
@@ -0,0 +1,63 @@
+//
+//  AllocationCounter.cc
+//  drafter
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "AllocationCounter.h"
+
+namespace
+{
+    std::atomic<size_t> Allocations{ 0 };
+    std::atomic<size_t> AllocatedBytes{ 0 };
+
+    void* CountedAllocation(std::size_t size)
+    {
+        Allocations.fetch_add(1, std::memory_order_relaxed);
+        AllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+        if (void* ptr = std::malloc(size ? size : 1))
+            return ptr;
+
+        throw std::bad_alloc();
+    }
+}
+
+drafter::perf::AllocationCount drafter::perf::CurrentAllocations()
+{
+    return { Allocations.load(std::memory_order_relaxed), AllocatedBytes.load(std::memory_order_relaxed) };
+}
+
+void* operator new(std::size_t size)
+{
+    return CountedAllocation(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return CountedAllocation(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
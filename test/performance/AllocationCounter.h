@@ -0,0 +1,32 @@
+//
+//  AllocationCounter.h
+//  drafter
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#ifndef DRAFTER_ALLOCATIONCOUNTER_H
+#define DRAFTER_ALLOCATIONCOUNTER_H
+
+#include <cstddef>
+
+namespace drafter
+{
+    namespace perf
+    {
+
+        /// Allocations done by the process so far
+        ///
+        /// Linking AllocationCounter.cc replaces the global operator new and delete,
+        /// every allocation of the process is then counted.
+        struct AllocationCount {
+            std::size_t allocations;
+            std::size_t bytes;
+        };
+
+        /// \returns Allocations done by all threads of the process so far
+        AllocationCount CurrentAllocations();
+    }
+}
+
+#endif // #ifndef DRAFTER_ALLOCATIONCOUNTER_H
@@ -0,0 +1,97 @@
+//
+//  CommandLine.cc
+//  drafter
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include "CommandLine.h"
+
+using namespace drafter::perf;
+
+namespace
+{
+    /// Width of the option column of the help
+    const int OptionWidth = 23;
+
+    void PrintOption(const OptionHelp& option)
+    {
+        std::istringstream lines(option.description);
+        std::string line;
+        const char* name = option.option;
+
+        while (std::getline(lines, line)) {
+            std::cout << "  " << std::left << std::setw(OptionWidth) << name << line << std::endl;
+            name = "";
+        }
+    }
+}
+
+void drafter::perf::Help(
+    const std::string& usage, const std::string& description, std::initializer_list<OptionHelp> options)
+{
+    std::cout << "usage: " << usage << std::endl << std::endl;
+    std::cout << description << std::endl << std::endl;
+    std::cout << "options:" << std::endl << std::endl;
+
+    for (const auto& option : options) {
+        PrintOption(option);
+    }
+
+    PrintOption({ "-h, --help", "display this help message" });
+    exit(0);
+}
+
+OptionHelp drafter::perf::ToleranceHelp(double defaultTolerance)
+{
+    std::ostringstream description;
+    description << "allowed growth over the expected one (default " << defaultTolerance << ")";
+
+    return { "-t, --tolerance <n>", description.str() };
+}
+
+bool drafter::perf::ReadFile(const std::string& fileName, std::string& content)
+{
+    std::ifstream inputFileStream(fileName.c_str());
+
+    if (!inputFileStream.is_open())
+        return false;
+
+    std::stringstream inputStream;
+    inputStream << inputFileStream.rdbuf();
+    content = inputStream.str();
+
+    return true;
+}
+
+size_t drafter::perf::ParseCount(const char* value, size_t minimum)
+{
+    char* end = nullptr;
+    unsigned long count = std::strtoul(value, &end, 10);
+
+    if (!end || *end != '\0' || count < minimum) {
+        std::cerr << "fatal: invalid count '" << value << "'\n";
+        exit(EXIT_FAILURE);
+    }
+
+    return count;
+}
+
+double drafter::perf::ParseTolerance(const char* value)
+{
+    char* end = nullptr;
+    double tolerance = std::strtod(value, &end);
+
+    if (!end || *end != '\0' || tolerance < 1) {
+        std::cerr << "fatal: invalid tolerance '" << value << "'\n";
+        exit(EXIT_FAILURE);
+    }
+
+    return tolerance;
+}
@@ -0,0 +1,48 @@
+//
+//  CommandLine.h
+//  drafter
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#ifndef DRAFTER_COMMANDLINE_H
+#define DRAFTER_COMMANDLINE_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+
+namespace drafter
+{
+    namespace perf
+    {
+
+        /// Option described by the help of a tool
+        struct OptionHelp {
+            const char* option;      // e.g. "-s, --scale <count>"
+            std::string description; // lines after the first are aligned with it
+        };
+
+        /// Print the help of a tool, including the help option, and exit
+        ///
+        /// \param usage        arguments of the tool, e.g. "perf-drafter [options] ..."
+        /// \param description  paragraphs describing the tool
+        /// \param options      options of the tool
+        [[noreturn]] void Help(
+            const std::string& usage, const std::string& description, std::initializer_list<OptionHelp> options);
+
+        /// \returns Help of the tolerance option
+        OptionHelp ToleranceHelp(double defaultTolerance);
+
+        /// \returns True if the file was read into the content
+        bool ReadFile(const std::string& fileName, std::string& content);
+
+        /// \returns Count given as an option value, exits if it is not a number of at least the minimum
+        size_t ParseCount(const char* value, size_t minimum = 0);
+
+        /// \returns Tolerance given as an option value, exits if it is not a number of at least one
+        double ParseTolerance(const char* value);
+    }
+}
+
+#endif // #ifndef DRAFTER_COMMANDLINE_H
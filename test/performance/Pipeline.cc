@@ -0,0 +1,212 @@
+//
+//  Pipeline.cc
+//  drafter
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#include <chrono>
+#include <sstream>
+#include <vector>
+
+#include "snowcrash.h"
+
+#include "sos.h"
+#include "sosJSON.h"
+#include "sosYAML.h"
+
+#include "ConversionContext.h"
+#include "NamedTypesRegistry.h"
+#include "NodeInfo.h"
+#include "RefractDataStructure.h"
+#include "Render.h"
+#include "SerializeResult.h"
+
+#include "refract/Element.h"
+#include "refract/Exception.h"
+
+#include "AllocationCounter.h"
+#include "Pipeline.h"
+
+namespace sc = snowcrash;
+
+using namespace drafter;
+using namespace drafter::perf;
+
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    const char* const StageNames[StageCount]
+        = { "parse", "named-types", "mson", "expand", "render", "wrap", "serialize", "json", "yaml" };
+
+    template <typename Function>
+    void Measure(StageMeasurement& measurement, Function&& function)
+    {
+        AllocationCount before = CurrentAllocations();
+        Clock::time_point start = Clock::now();
+
+        function();
+
+        Clock::time_point end = Clock::now();
+        AllocationCount after = CurrentAllocations();
+
+        measurement.measured = true;
+        measurement.time = std::chrono::duration<double>(end - start).count();
+        measurement.allocations = after.allocations - before.allocations;
+        measurement.allocatedBytes = after.bytes - before.bytes;
+    }
+
+    /// Nodes of the blueprint the per node stages work on
+    struct PipelineNodes {
+        std::vector<NodeInfo<sc::DataStructure> > dataStructures;
+        std::vector<std::pair<NodeInfo<sc::Payload>, NodeInfo<sc::Action> > > payloads;
+    };
+
+    void CollectDataStructure(const NodeInfo<sc::DataStructure>& dataStructure, PipelineNodes& nodes)
+    {
+        if (!dataStructure.node->empty())
+            nodes.dataStructures.push_back(dataStructure);
+    }
+
+    void CollectPayloads(
+        const NodeInfo<sc::Requests>& payloads, const NodeInfo<sc::Action>& action, PipelineNodes& nodes)
+    {
+        for (const auto& payload : NodeInfoCollection<sc::Requests>(payloads)) {
+            CollectDataStructure(MAKE_NODE_INFO(payload, attributes), nodes);
+            nodes.payloads.push_back(std::make_pair(payload, action));
+        }
+    }
+
+    void CollectNodes(const NodeInfo<sc::Elements>& elements, PipelineNodes& nodes)
+    {
+        for (const auto& element : NodeInfoCollection<sc::Elements>(elements)) {
+
+            switch (element.node->element) {
+                case sc::Element::CategoryElement:
+                    CollectNodes(MAKE_NODE_INFO(element, content.elements()), nodes);
+                    break;
+
+                case sc::Element::DataStructureElement:
+                    CollectDataStructure(MAKE_NODE_INFO(element, content.dataStructure), nodes);
+                    break;
+
+                case sc::Element::ResourceElement: {
+                    NodeInfo<sc::Resource> resource = MAKE_NODE_INFO(element, content.resource);
+                    CollectDataStructure(MAKE_NODE_INFO(resource, attributes), nodes);
+
+                    for (const auto& action : NodeInfoCollection<sc::Actions>(MAKE_NODE_INFO(resource, actions))) {
+                        CollectDataStructure(MAKE_NODE_INFO(action, attributes), nodes);
+
+                        for (const auto& example :
+                            NodeInfoCollection<sc::TransactionExamples>(MAKE_NODE_INFO(action, examples))) {
+                            CollectPayloads(MAKE_NODE_INFO(example, requests), action, nodes);
+                            CollectPayloads(MAKE_NODE_INFO(example, responses), action, nodes);
+                        }
+                    }
+                    break;
+                }
+
+                default:
+                    break;
+            }
+        }
+    }
+
+    /// Stages working on the named types and the nodes of the parsed blueprint
+    void RunConversionStages(const sc::ParseResult<sc::Blueprint>& blueprint, PipelineRun& run)
+    {
+        WrapperOptions options;
+        ConversionContext context(options);
+
+        PipelineNodes nodes;
+        CollectNodes(MakeNodeInfo(blueprint.node.content.elements(), blueprint.sourceMap.content.elements()), nodes);
+
+        try {
+            Measure(run.stages[NamedTypesStage], [&]() {
+                RegisterNamedTypes(
+                    MakeNodeInfo(blueprint.node.content.elements(), blueprint.sourceMap.content.elements()), context);
+            });
+
+            std::vector<std::unique_ptr<refract::IElement> > elements;
+
+            Measure(run.stages[MSONStage], [&]() {
+                for (const auto& dataStructure : nodes.dataStructures) {
+                    elements.push_back(MSONToRefract(dataStructure, context));
+                }
+            });
+
+            Measure(run.stages[ExpandStage], [&]() {
+                for (auto& element : elements) {
+                    element = ExpandRefract(std::move(element), context);
+                }
+            });
+
+            Measure(run.stages[RenderStage], [&]() {
+                for (const auto& payload : nodes.payloads) {
+                    try {
+                        renderPayloadBody(payload.first, payload.second, context);
+                        renderPayloadSchema(payload.first, payload.second, context);
+                    } catch (sc::Error&) {
+                        // Rendering failures are reported as warnings, the payload is skipped
+                    } catch (refract::LogicError&) {
+                    }
+                }
+            });
+        } catch (sc::Error& e) {
+            run.error = e.message;
+        } catch (std::exception& e) {
+            run.error = e.what();
+        }
+
+        context.GetNamedTypesRegistry().clearAll(true);
+    }
+}
+
+const char* drafter::perf::StageName(Stage stage)
+{
+    return stage < StageCount ? StageNames[stage] : "unknown";
+}
+
+PipelineRun drafter::perf::RunPipeline(const std::string& source)
+{
+    PipelineRun run;
+    sc::ParseResult<sc::Blueprint> blueprint;
+
+    Measure(run.stages[ParseStage], [&]() { sc::parse(source, sc::ExportSourcemapOption, blueprint); });
+
+    if (blueprint.report.error.code != sc::Error::OK) {
+        run.error = blueprint.report.error.message;
+        return run;
+    }
+
+    RunConversionStages(blueprint, run);
+
+    std::unique_ptr<refract::IElement> result;
+
+    Measure(run.stages[WrapStage], [&]() {
+        WrapperOptions options;
+        ConversionContext context(options);
+        result = WrapRefract(blueprint, context);
+    });
+
+    sos::Object object;
+
+    Measure(run.stages[SerializeStage], [&]() {
+        WrapperOptions options(true);
+        ConversionContext context(options);
+        object = SerializeRefract(result.get(), context);
+    });
+
+    Measure(run.stages[JSONStage], [&]() {
+        std::ostringstream out;
+        sos::SerializeJSON().process(object, out);
+    });
+
+    Measure(run.stages[YAMLStage], [&]() {
+        std::ostringstream out;
+        sos::SerializeYAML().process(object, out);
+    });
+
+    return run;
+}
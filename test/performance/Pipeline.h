@@ -0,0 +1,58 @@
+//
+//  Pipeline.h
+//  drafter
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#ifndef DRAFTER_PIPELINE_H
+#define DRAFTER_PIPELINE_H
+
+#include <cstddef>
+#include <string>
+
+namespace drafter
+{
+    namespace perf
+    {
+
+        /// Pipeline stages in the order they are run
+        enum Stage
+        {
+            ParseStage = 0,  // snowcrash::parse (markdown and blueprint sections)
+            NamedTypesStage, // RegisterNamedTypes
+            MSONStage,       // MSONToRefract of every data structure
+            ExpandStage,     // ExpandRefract of every converted data structure
+            RenderStage,     // renderPayloadBody and renderPayloadSchema of every payload
+            WrapStage,       // WrapRefract, the whole conversion to refract
+            SerializeStage,  // SerializeRefract
+            JSONStage,       // sos JSON writer
+            YAMLStage,       // sos YAML writer
+            StageCount
+        };
+
+        /// \returns Name of the stage as used in the reports
+        const char* StageName(Stage stage);
+
+        /// Time and allocations of a stage
+        struct StageMeasurement {
+            bool measured = false;
+            double time = 0;           // s
+            size_t allocations = 0;    // by all threads of the process
+            size_t allocatedBytes = 0; // by all threads of the process
+        };
+
+        /// Measurements of a single run of the pipeline
+        struct PipelineRun {
+            std::string error;
+            StageMeasurement stages[StageCount];
+        };
+
+        /// Run every stage of the pipeline over the source
+        ///
+        /// Only the parse stage is measured if the blueprint cannot be parsed.
+        PipelineRun RunPipeline(const std::string& source);
+    }
+}
+
+#endif // #ifndef DRAFTER_PIPELINE_H
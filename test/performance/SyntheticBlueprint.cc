@@ -0,0 +1,214 @@
+//
+//  SyntheticBlueprint.cc
+//  drafter
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#include <sstream>
+#include "SyntheticBlueprint.h"
+
+using namespace drafter::perf;
+
+namespace
+{
+    void WriteHeader(std::ostream& out, const char* name)
+    {
+        out << "FORMAT: 1A\n\n";
+        out << "# Synthetic " << name << "\n\n";
+    }
+
+    void WriteResource(std::ostream& out, const std::string& name, const std::string& uri, const std::string& type)
+    {
+        out << "## " << name << " [" << uri << "]\n\n";
+        out << "### Retrieve " << name << " [GET]\n\n";
+        out << "+ Response 200 (application/json)\n\n";
+        out << "    + Attributes (" << type << ")\n\n";
+    }
+
+    void WriteResources(std::ostream& out, size_t scale)
+    {
+        out << "# Group Items\n\n";
+
+        for (size_t i = 0; i < scale; ++i) {
+            WriteResource(out, "Item " + std::to_string(i), "/items/" + std::to_string(i), "Item");
+        }
+
+        out << "# Data Structures\n\n";
+        out << "## Item (object)\n\n";
+        out << "+ id: 1 (number, required)\n";
+        out << "+ name: item (string)\n";
+        out << "+ tags: a, b (array[string])\n\n";
+    }
+
+    void WriteNamedTypes(std::ostream& out, size_t scale)
+    {
+        // Every type refers to one of the previous types, the references form a balanced tree
+        out << "# Group Types\n\n";
+        WriteResource(out, "Types", "/types", "Type" + std::to_string(scale ? scale - 1 : 0));
+
+        out << "# Data Structures\n\n";
+
+        for (size_t i = 0; i < scale; ++i) {
+            out << "## Type" << i << " (object)\n\n";
+            out << "+ id: " << i << " (number)\n";
+            out << "+ name: type " << i << " (string)\n";
+
+            if (i > 0) {
+                out << "+ previous (Type" << (i - 1) / 2 << ")\n";
+            }
+
+            out << "\n";
+        }
+    }
+
+    void WriteDeepInheritance(std::ostream& out, size_t scale)
+    {
+        out << "# Group Bases\n\n";
+        WriteResource(out, "Bases", "/bases", "Base" + std::to_string(scale ? scale - 1 : 0));
+
+        out << "# Data Structures\n\n";
+        out << "## Base0 (object)\n\n";
+        out << "+ property0: 0 (number)\n\n";
+
+        for (size_t i = 1; i < scale; ++i) {
+            out << "## Base" << i << " (Base" << i - 1 << ")\n\n";
+            out << "+ property" << i << ": " << i << " (number)\n\n";
+        }
+    }
+
+    void WriteWideEnum(std::ostream& out, size_t scale)
+    {
+        out << "# Group Values\n\n";
+        WriteResource(out, "Values", "/values", "Holder");
+
+        out << "# Data Structures\n\n";
+        out << "## Holder (object)\n\n";
+        out << "+ value (Value, required)\n\n";
+        out << "## Value (enum)\n\n";
+
+        for (size_t i = 0; i < scale; ++i) {
+            out << "+ value" << i << "\n";
+        }
+
+        out << "\n";
+    }
+
+    void WriteMixinChain(std::ostream& out, size_t scale)
+    {
+        out << "# Group Mixins\n\n";
+        WriteResource(out, "Mixins", "/mixins", "Mixin" + std::to_string(scale ? scale - 1 : 0));
+
+        out << "# Data Structures\n\n";
+        out << "## Mixin0 (object)\n\n";
+        out << "+ field0: 0 (number)\n\n";
+
+        for (size_t i = 1; i < scale; ++i) {
+            out << "## Mixin" << i << " (object)\n\n";
+            out << "+ Include Mixin" << i - 1 << "\n";
+            out << "+ field" << i << ": " << i << " (number)\n\n";
+        }
+    }
+
+    void WriteWideObject(std::ostream& out, size_t scale)
+    {
+        const char* const types[] = { "string", "number", "boolean" };
+        const char* const values[] = { "value", "42", "true" };
+
+        out << "# Group Objects\n\n";
+        WriteResource(out, "Objects", "/objects", "Wide");
+
+        out << "# Data Structures\n\n";
+        out << "## Wide (object)\n\n";
+
+        for (size_t i = 0; i < scale; ++i) {
+            out << "+ property" << i << ": " << values[i % 3] << " (" << types[i % 3] << ")";
+            out << " - Property " << i << " of a wide object\n";
+        }
+
+        out << "\n";
+    }
+}
+
+const char* drafter::perf::ShapeName(BlueprintShape shape)
+{
+    switch (shape) {
+        case ResourcesShape:
+            return "resources";
+        case NamedTypesShape:
+            return "named-types";
+        case DeepInheritanceShape:
+            return "deep-inheritance";
+        case WideEnumShape:
+            return "wide-enum";
+        case MixinChainShape:
+            return "mixin-chain";
+        case WideObjectShape:
+            return "wide-object";
+        case ShapeCount:
+            break;
+    }
+
+    return "unknown";
+}
+
+bool drafter::perf::FindShape(const std::string& name, BlueprintShape& shape)
+{
+    for (size_t i = 0; i < ShapeCount; ++i) {
+        if (name == ShapeName(static_cast<BlueprintShape>(i))) {
+            shape = static_cast<BlueprintShape>(i);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool drafter::perf::IsQuadraticStage(BlueprintShape shape, Stage stage)
+{
+    return stage == ExpandStage && (shape == DeepInheritanceShape || shape == MixinChainShape);
+}
+
+std::string drafter::perf::GenerateBlueprint(BlueprintShape shape, size_t scale)
+{
+    std::ostringstream out;
+
+    WriteHeader(out, ShapeName(shape));
+
+    switch (shape) {
+        case ResourcesShape:
+            WriteResources(out, scale);
+            break;
+        case NamedTypesShape:
+            WriteNamedTypes(out, scale);
+            break;
+        case DeepInheritanceShape:
+            WriteDeepInheritance(out, scale);
+            break;
+        case WideEnumShape:
+            WriteWideEnum(out, scale);
+            break;
+        case MixinChainShape:
+            WriteMixinChain(out, scale);
+            break;
+        case WideObjectShape:
+            WriteWideObject(out, scale);
+            break;
+        case ShapeCount:
+            break;
+    }
+
+    return out.str();
+}
+
+std::vector<SyntheticBlueprint> drafter::perf::GenerateBlueprints(size_t scale)
+{
+    std::vector<SyntheticBlueprint> blueprints;
+
+    for (size_t i = 0; i < ShapeCount; ++i) {
+        BlueprintShape shape = static_cast<BlueprintShape>(i);
+        blueprints.push_back({ shape, ShapeName(shape), scale, GenerateBlueprint(shape, scale) });
+    }
+
+    return blueprints;
+}
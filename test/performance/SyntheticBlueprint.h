@@ -0,0 +1,60 @@
+//
+//  SyntheticBlueprint.h
+//  drafter
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#ifndef DRAFTER_SYNTHETICBLUEPRINT_H
+#define DRAFTER_SYNTHETICBLUEPRINT_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Pipeline.h"
+
+namespace drafter
+{
+    namespace perf
+    {
+
+        /// Shape of a generated blueprint
+        enum BlueprintShape
+        {
+            ResourcesShape = 0,       // N resources with an action and a JSON response each
+            NamedTypesShape,          // N named types, each referring to one of the preceding types
+            DeepInheritanceShape,     // Chain of N named types, each extending the previous one
+            WideEnumShape,            // Named enum with N members used by a resource
+            MixinChainShape,          // Chain of N named types, each including the previous one as a mixin
+            WideObjectShape,          // Named object with N properties used by a resource
+            ShapeCount
+        };
+
+        /// Generated blueprint with the description of its shape
+        struct SyntheticBlueprint {
+            BlueprintShape shape;
+            std::string name;
+            std::size_t scale;
+            std::string source;
+        };
+
+        /// \returns Name of the shape as used in the benchmark reports
+        const char* ShapeName(BlueprintShape shape);
+
+        /// Find the shape by its name, \returns False if there is no such shape
+        bool FindShape(const std::string& name, BlueprintShape& shape);
+
+        /// \returns True if the stage grows quadratically with the scale of the shape,
+        /// every expanded type of an inheritance or mixin chain contains the members of all the preceding types
+        bool IsQuadraticStage(BlueprintShape shape, Stage stage);
+
+        /// \returns API Blueprint of the shape with `scale` repeated items
+        std::string GenerateBlueprint(BlueprintShape shape, std::size_t scale);
+
+        /// \returns Blueprints of all the shapes with `scale` repeated items
+        std::vector<SyntheticBlueprint> GenerateBlueprints(std::size_t scale);
+    }
+}
+
+#endif // #ifndef DRAFTER_SYNTHETICBLUEPRINT_H
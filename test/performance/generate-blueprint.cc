@@ -0,0 +1,88 @@
+//
+//  generate-blueprint.cc
+//  drafter
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "CommandLine.h"
+#include "SyntheticBlueprint.h"
+
+using namespace drafter::perf;
+
+static const size_t DefaultScale = 100;
+
+namespace
+{
+    void Help()
+    {
+        drafter::perf::Help("generate-blueprint [options] ...",
+            "Synthetic API Blueprint Generator",
+            { { "-t, --shape <name>",
+                  std::string("shape of the blueprint (default ") + ShapeName(ResourcesShape) + ")" },
+                { "-s, --scale <count>", "number of repeated items (default " + std::to_string(DefaultScale) + ")" },
+                { "-o, --output <file>", "save the blueprint into file (default stdout)" },
+                { "-l, --list", "list the shapes" } });
+    }
+
+    void ListShapes()
+    {
+        for (size_t i = 0; i < ShapeCount; ++i) {
+            std::cout << ShapeName(static_cast<BlueprintShape>(i)) << std::endl;
+        }
+
+        exit(0);
+    }
+}
+
+int main(int argc, const char* argv[])
+{
+    BlueprintShape shape = ResourcesShape;
+    size_t scale = DefaultScale;
+    std::string output;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+
+        if (arg == "-h" || arg == "--help") {
+            Help();
+        } else if (arg == "-l" || arg == "--list") {
+            ListShapes();
+        } else if ((arg == "-t" || arg == "--shape") && i + 1 < argc) {
+            if (!FindShape(argv[++i], shape)) {
+                std::cerr << "fatal: unknown shape '" << argv[i] << "'\n";
+                exit(EXIT_FAILURE);
+            }
+        } else if ((arg == "-s" || arg == "--scale") && i + 1 < argc) {
+            scale = ParseCount(argv[++i], 1);
+        } else if ((arg == "-o" || arg == "--output") && i + 1 < argc) {
+            output = argv[++i];
+        } else {
+            std::cerr << "fatal: unexpected argument '" << arg << "'\n";
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    std::string blueprint = GenerateBlueprint(shape, scale);
+
+    if (output.empty()) {
+        std::cout << blueprint;
+        return EXIT_SUCCESS;
+    }
+
+    std::ofstream outputStream(output.c_str());
+
+    if (!outputStream.is_open()) {
+        std::cerr << "fatal: unable to open output file '" << output << "'\n";
+        exit(EXIT_FAILURE);
+    }
+
+    outputStream << blueprint;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,388 @@
+//
+//  perf-drafter.cc
+//  drafter
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if !defined(_MSC_VER)
+#include <sys/resource.h>
+#endif
+
+#include "utils/so/JsonIo.h"
+#include "utils/so/Value.h"
+
+#include "CommandLine.h"
+#include "Pipeline.h"
+#include "SyntheticBlueprint.h"
+
+namespace so = drafter::utils::so;
+
+using namespace drafter;
+
+static const size_t DefaultRunCount = 20;
+static const size_t DefaultScale = 100;
+
+static const size_t ScalingSteps = 3;             // 1x, 10x, 100x
+static const size_t ScalingFactor = 10;           // between the steps
+static const double DefaultTolerance = 2.0;       // allowed growth over the expected one
+static const double MinimumComparableTime = 2e-4; // s, shorter stages are dominated by noise
+
+namespace
+{
+    /// Measurements of a stage over all the runs
+    struct StageSamples {
+        std::vector<double> times; // s
+        size_t allocations = 0;    // in the last run
+        size_t allocatedBytes = 0; // in the last run
+    };
+
+    /// Benchmarked input and its measurements
+    struct Benchmark {
+        std::string name;
+        std::string source;
+        perf::BlueprintShape shape = perf::ShapeCount; // of generated blueprints
+        size_t scale = 0;
+        std::string error;
+        StageSamples stages[perf::StageCount];
+    };
+
+    void Run(Benchmark& benchmark)
+    {
+        perf::PipelineRun run = perf::RunPipeline(benchmark.source);
+
+        if (!run.error.empty())
+            benchmark.error = run.error;
+
+        for (size_t stage = 0; stage < perf::StageCount; ++stage) {
+            const perf::StageMeasurement& measurement = run.stages[stage];
+
+            if (!measurement.measured)
+                continue;
+
+            StageSamples& samples = benchmark.stages[stage];
+            samples.times.push_back(measurement.time);
+            samples.allocations = measurement.allocations;
+            samples.allocatedBytes = measurement.allocatedBytes;
+        }
+    }
+
+    /// \returns Value at the percentile of the sorted samples
+    double Percentile(const std::vector<double>& sorted, size_t percentile)
+    {
+        if (sorted.empty())
+            return 0;
+
+        size_t rank = (sorted.size() * percentile + 99) / 100;
+        return sorted[rank ? rank - 1 : 0];
+    }
+
+    /// \returns Peak resident set size of the process in kB
+    size_t PeakRSS()
+    {
+#if defined(_MSC_VER)
+        return 0;
+#else
+        struct rusage usage;
+
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+            return 0;
+
+#if defined(__APPLE__)
+        return usage.ru_maxrss / 1024;
+#else
+        return usage.ru_maxrss;
+#endif
+#endif
+    }
+
+    std::vector<double> SortedTimes(const StageSamples& samples)
+    {
+        std::vector<double> sorted = samples.times;
+        std::sort(sorted.begin(), sorted.end());
+        return sorted;
+    }
+
+    /// Growth of the median time of a stage between two scales of a generated blueprint
+    struct ScalingCheck {
+        const Benchmark* smaller;
+        const Benchmark* larger;
+        perf::Stage stage;
+        double growth;
+        double limit;
+        bool passed;
+    };
+
+    /// Compare the stages of the consecutive scales of every generated blueprint
+    std::vector<ScalingCheck> CheckScaling(const std::vector<Benchmark>& benchmarks, double tolerance)
+    {
+        std::vector<ScalingCheck> checks;
+
+        for (size_t i = 1; i < benchmarks.size(); ++i) {
+            const Benchmark& smaller = benchmarks[i - 1];
+            const Benchmark& larger = benchmarks[i];
+
+            if (smaller.shape != larger.shape || smaller.shape == perf::ShapeCount || !smaller.scale
+                || !smaller.error.empty() || !larger.error.empty())
+                continue;
+
+            double ratio = static_cast<double>(larger.scale) / smaller.scale;
+
+            for (size_t stage = 0; stage < perf::StageCount; ++stage) {
+                double limit = tolerance
+                    * (perf::IsQuadraticStage(smaller.shape, static_cast<perf::Stage>(stage)) ? ratio * ratio : ratio);
+
+                const StageSamples& from = smaller.stages[stage];
+                const StageSamples& to = larger.stages[stage];
+
+                if (from.times.empty() || to.times.empty())
+                    continue;
+
+                double fromTime = Percentile(SortedTimes(from), 50);
+                double toTime = Percentile(SortedTimes(to), 50);
+
+                if (fromTime < MinimumComparableTime)
+                    continue;
+
+                double growth = toTime / fromTime;
+                checks.push_back(
+                    { &smaller, &larger, static_cast<perf::Stage>(stage), growth, limit, growth <= limit });
+            }
+        }
+
+        return checks;
+    }
+
+    so::Object ScalingReport(const ScalingCheck& check)
+    {
+        so::Object report;
+
+        report.data.emplace_back("name", so::String{ check.smaller->name });
+        report.data.emplace_back("stage", so::String{ perf::StageName(check.stage) });
+        report.data.emplace_back("from", so::Number(check.smaller->scale));
+        report.data.emplace_back("to", so::Number(check.larger->scale));
+        report.data.emplace_back("growth", so::Number(check.growth));
+        report.data.emplace_back("limit", so::Number(check.limit));
+
+        if (check.passed)
+            report.data.emplace_back("passed", so::True{});
+        else
+            report.data.emplace_back("passed", so::False{});
+
+        return report;
+    }
+
+    so::Object StageReport(const StageSamples& samples)
+    {
+        std::vector<double> sorted = SortedTimes(samples);
+
+        so::Object report;
+
+        report.data.emplace_back("median", so::Number(Percentile(sorted, 50)));
+        report.data.emplace_back("p95", so::Number(Percentile(sorted, 95)));
+        report.data.emplace_back("allocations", so::Number(samples.allocations));
+        report.data.emplace_back("allocatedBytes", so::Number(samples.allocatedBytes));
+
+        return report;
+    }
+
+    so::Object BenchmarkReport(const Benchmark& benchmark)
+    {
+        so::Object report;
+
+        report.data.emplace_back("name", so::String{ benchmark.name });
+
+        if (benchmark.scale)
+            report.data.emplace_back("scale", so::Number(benchmark.scale));
+
+        report.data.emplace_back("size", so::Number(benchmark.source.size()));
+
+        if (!benchmark.error.empty())
+            report.data.emplace_back("error", so::String{ benchmark.error });
+
+        so::Object stages;
+
+        for (size_t i = 0; i < perf::StageCount; ++i) {
+            const perf::Stage stage = static_cast<perf::Stage>(i);
+
+            if (!benchmark.stages[stage].times.empty())
+                stages.data.emplace_back(perf::StageName(stage), StageReport(benchmark.stages[stage]));
+        }
+
+        report.data.emplace_back("stages", std::move(stages));
+
+        return report;
+    }
+
+    void Help()
+    {
+        perf::Help("perf-drafter [options] ... [<input file> ...]",
+            "API Blueprint to Refract Pipeline Performance Test Tool\n\n"
+            "Times every stage of the pipeline over the input files and generated blueprints,\n"
+            "the report is written as JSON.",
+            { { "-r, --runs <count>",
+                  "number of runs of every input (default " + std::to_string(DefaultRunCount) + ")" },
+                { "-s, --scale <count>",
+                    "number of items of generated blueprints, 0 to skip them (default " + std::to_string(DefaultScale)
+                        + ")" },
+                { "-S, --scaling <count>",
+                    "run the generated blueprints with count, 10 and 100 times more items\n"
+                    "and fail if a stage grows superlinearly" },
+                perf::ToleranceHelp(DefaultTolerance),
+                { "-o, --output <file>", "save the report into file (default stdout)" } });
+    }
+
+    void AddGeneratedBenchmarks(std::vector<Benchmark>& benchmarks, size_t scale)
+    {
+        for (auto& blueprint : perf::GenerateBlueprints(scale)) {
+            Benchmark benchmark;
+            benchmark.name = blueprint.name;
+            benchmark.shape = blueprint.shape;
+            benchmark.scale = blueprint.scale;
+            benchmark.source = std::move(blueprint.source);
+            benchmarks.push_back(std::move(benchmark));
+        }
+    }
+
+    /// Generated blueprints of every shape, ordered by the shape and the scale
+    void AddScalingBenchmarks(std::vector<Benchmark>& benchmarks, size_t scale)
+    {
+        std::vector<Benchmark> steps;
+
+        for (size_t step = 0; step < ScalingSteps; ++step, scale *= ScalingFactor) {
+            AddGeneratedBenchmarks(steps, scale);
+        }
+
+        const size_t shapes = steps.size() / ScalingSteps;
+
+        for (size_t shape = 0; shape < shapes; ++shape) {
+            for (size_t step = 0; step < ScalingSteps; ++step) {
+                benchmarks.push_back(std::move(steps[step * shapes + shape]));
+            }
+        }
+    }
+}
+
+int main(int argc, const char* argv[])
+{
+    size_t runs = DefaultRunCount;
+    size_t scale = DefaultScale;
+    size_t scalingScale = 0;
+    double tolerance = DefaultTolerance;
+    std::string output;
+    std::vector<std::string> inputs;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+
+        if (arg == "-h" || arg == "--help") {
+            Help();
+        } else if ((arg == "-r" || arg == "--runs") && i + 1 < argc) {
+            runs = perf::ParseCount(argv[++i]);
+        } else if ((arg == "-s" || arg == "--scale") && i + 1 < argc) {
+            scale = perf::ParseCount(argv[++i]);
+        } else if ((arg == "-S" || arg == "--scaling") && i + 1 < argc) {
+            scalingScale = perf::ParseCount(argv[++i]);
+        } else if ((arg == "-t" || arg == "--tolerance") && i + 1 < argc) {
+            tolerance = perf::ParseTolerance(argv[++i]);
+        } else if ((arg == "-o" || arg == "--output") && i + 1 < argc) {
+            output = argv[++i];
+        } else if (!arg.empty() && arg[0] == '-') {
+            std::cerr << "fatal: unknown option '" << arg << "'\n";
+            exit(EXIT_FAILURE);
+        } else {
+            inputs.push_back(arg);
+        }
+    }
+
+    if (runs == 0) {
+        std::cerr << "fatal: at least one run expected\n";
+        exit(EXIT_FAILURE);
+    }
+
+    std::vector<Benchmark> benchmarks;
+
+    for (const auto& input : inputs) {
+        Benchmark benchmark;
+        benchmark.name = input;
+
+        if (!perf::ReadFile(input, benchmark.source)) {
+            std::cerr << "fatal: unable to open input file '" << input << "'\n";
+            exit(EXIT_FAILURE);
+        }
+
+        benchmarks.push_back(std::move(benchmark));
+    }
+
+    if (scalingScale) {
+        AddScalingBenchmarks(benchmarks, scalingScale);
+    } else if (scale) {
+        AddGeneratedBenchmarks(benchmarks, scale);
+    }
+
+    so::Array results;
+
+    for (auto& benchmark : benchmarks) {
+        std::cerr << "running drafter performance test '" << benchmark.name << "'";
+
+        if (benchmark.scale)
+            std::cerr << " at scale " << benchmark.scale;
+
+        std::cerr << " " << runs << "-times...\n";
+
+        for (size_t run = 0; run < runs; ++run) {
+            Run(benchmark);
+        }
+
+        results.data.emplace_back(BenchmarkReport(benchmark));
+    }
+
+    so::Object report;
+    report.data.emplace_back("runs", so::Number(runs));
+    report.data.emplace_back("peakRSS", so::Number(PeakRSS()));
+    report.data.emplace_back("benchmarks", std::move(results));
+
+    int result = EXIT_SUCCESS;
+
+    if (scalingScale) {
+        so::Array scaling;
+
+        for (const auto& check : CheckScaling(benchmarks, tolerance)) {
+            if (!check.passed) {
+                std::cerr << "superlinear growth of stage '" << perf::StageName(check.stage) << "' of '"
+                          << check.smaller->name << "' from scale " << check.smaller->scale << " to "
+                          << check.larger->scale << ": " << check.growth << "x (limit " << check.limit << "x)\n";
+                result = EXIT_FAILURE;
+            }
+
+            scaling.data.emplace_back(ScalingReport(check));
+        }
+
+        report.data.emplace_back("scaling", std::move(scaling));
+    }
+
+    const so::Value value{ std::move(report) };
+
+    if (output.empty()) {
+        so::serialize_json(std::cout, value) << std::endl;
+        return result;
+    }
+
+    std::ofstream outputStream(output.c_str());
+
+    if (!outputStream.is_open()) {
+        std::cerr << "fatal: unable to open output file '" << output << "'\n";
+        exit(EXIT_FAILURE);
+    }
+
+    so::serialize_json(outputStream, value) << std::endl;
+
+    return result;
+}
@@ -0,0 +1,301 @@
+//
+//  test-allocations.cc
+//  drafter
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "CommandLine.h"
+#include "Pipeline.h"
+#include "SyntheticBlueprint.h"
+
+using namespace drafter;
+
+static const size_t DefaultScale = 25;
+static const size_t ScalingFactor = 4;      // between the compared scales
+static const double DefaultTolerance = 2.0; // allowed growth over the expected one
+static const double Headroom = 0.1;         // allowed growth over the recorded baseline
+
+namespace
+{
+    /// Allocations of a stage recorded for a fixture
+    struct Baseline {
+        size_t allocations;
+        size_t bytes;
+    };
+
+    /// Baselines by the fixture and the stage name
+    typedef std::map<std::pair<std::string, std::string>, Baseline> Baselines;
+
+    struct Options {
+        size_t scale = DefaultScale;
+        double tolerance = DefaultTolerance;
+        bool verbose = false;
+        bool requireBaselines = false;
+        std::string baselineFile;
+        std::string recordFile;
+        std::vector<std::string> inputs;
+    };
+
+    struct Results {
+        size_t checks = 0;
+        size_t failures = 0;
+        size_t missingBaselines = 0;
+    };
+
+    /// \returns Measurements of the pipeline over the source, without the one time initializations
+    perf::PipelineRun Measure(const std::string& source)
+    {
+        perf::RunPipeline(source);
+        return perf::RunPipeline(source);
+    }
+
+    /// Read baselines written by RecordBaselines, exits if the file is malformed
+    void ReadBaselines(const std::string& fileName, Baselines& baselines)
+    {
+        std::string content;
+
+        if (!perf::ReadFile(fileName, content)) {
+            std::cerr << "fatal: unable to open baseline file '" << fileName << "'\n";
+            exit(EXIT_FAILURE);
+        }
+
+        std::istringstream lines(content);
+        std::string line;
+
+        while (std::getline(lines, line)) {
+
+            if (line.empty() || line[0] == '#')
+                continue;
+
+            std::istringstream fields(line);
+            std::string fixture, stage;
+            Baseline baseline;
+
+            if (!std::getline(fields, fixture, '\t') || !std::getline(fields, stage, '\t')
+                || !(fields >> baseline.allocations >> baseline.bytes)) {
+                std::cerr << "fatal: invalid baseline '" << line << "' in '" << fileName << "'\n";
+                exit(EXIT_FAILURE);
+            }
+
+            baselines[std::make_pair(fixture, stage)] = baseline;
+        }
+    }
+
+    void RecordBaselines(const std::string& name, const perf::PipelineRun& run, std::ostream& out)
+    {
+        for (size_t i = 0; i < perf::StageCount; ++i) {
+
+            const perf::Stage stage = static_cast<perf::Stage>(i);
+            const perf::StageMeasurement& measurement = run.stages[stage];
+
+            if (!measurement.measured)
+                continue;
+
+            out << name << '\t' << perf::StageName(stage) << '\t' << measurement.allocations << '\t'
+                << measurement.allocatedBytes << '\n';
+        }
+    }
+
+    /// \returns Baseline value with the headroom
+    size_t Limit(size_t baseline)
+    {
+        return static_cast<size_t>(std::ceil(baseline * (1 + Headroom)));
+    }
+
+    void CheckBaselines(const std::string& name,
+        const perf::PipelineRun& run,
+        const Baselines& baselines,
+        const Options& options,
+        Results& results)
+    {
+        for (size_t i = 0; i < perf::StageCount; ++i) {
+
+            const perf::Stage stage = static_cast<perf::Stage>(i);
+            const perf::StageMeasurement& measurement = run.stages[stage];
+
+            if (!measurement.measured)
+                continue;
+
+            auto baseline = baselines.find(std::make_pair(name, std::string(perf::StageName(stage))));
+
+            if (baseline == baselines.end()) {
+                ++results.missingBaselines;
+
+                if (options.requireBaselines || options.verbose) {
+                    std::cerr << "no allocation baseline for stage '" << perf::StageName(stage) << "' of '" << name
+                              << "'\n";
+                }
+
+                continue;
+            }
+
+            const size_t allocationLimit = Limit(baseline->second.allocations);
+            const size_t byteLimit = Limit(baseline->second.bytes);
+
+            ++results.checks;
+
+            bool passed = measurement.allocations <= allocationLimit && measurement.allocatedBytes <= byteLimit;
+
+            if (!passed)
+                ++results.failures;
+
+            if (!passed || options.verbose) {
+                std::cerr << (passed ? "" : "allocation baseline exceeded: ") << "stage '" << perf::StageName(stage)
+                          << "' of '" << name << "': " << measurement.allocations << " allocations (limit "
+                          << allocationLimit << "), " << measurement.allocatedBytes << " bytes (limit " << byteLimit
+                          << ")\n";
+            }
+        }
+    }
+
+    void CheckScaling(perf::BlueprintShape shape, const Options& options, Results& results)
+    {
+        const size_t smallerScale = options.scale;
+        const size_t largerScale = options.scale * ScalingFactor;
+
+        perf::PipelineRun smaller = Measure(perf::GenerateBlueprint(shape, smallerScale));
+        perf::PipelineRun larger = Measure(perf::GenerateBlueprint(shape, largerScale));
+
+        const double ratio = static_cast<double>(largerScale) / smallerScale;
+
+        for (size_t i = 0; i < perf::StageCount; ++i) {
+
+            const perf::Stage stage = static_cast<perf::Stage>(i);
+            const double limit = options.tolerance * (perf::IsQuadraticStage(shape, stage) ? ratio * ratio : ratio);
+            const perf::StageMeasurement& from = smaller.stages[stage];
+            const perf::StageMeasurement& to = larger.stages[stage];
+
+            if (!from.measured || !to.measured || !from.allocations)
+                continue;
+
+            ++results.checks;
+
+            double growth = static_cast<double>(to.allocations) / from.allocations;
+            bool passed = growth <= limit;
+
+            if (!passed)
+                ++results.failures;
+
+            if (!passed || options.verbose) {
+                std::cerr << (passed ? "" : "superlinear allocation growth: ") << "stage '" << perf::StageName(stage)
+                          << "' of '" << perf::ShapeName(shape) << "' from scale " << smallerScale << " to "
+                          << largerScale << ": " << from.allocations << " to " << to.allocations << " allocations, "
+                          << growth << "x (limit " << limit << "x)\n";
+            }
+        }
+    }
+
+    void Help()
+    {
+        std::ostringstream description;
+        description << "API Blueprint to Refract Pipeline Allocation Test\n\n"
+                    << "Counts the allocations of every stage of the pipeline over the input files\n"
+                    << "and fails if a stage exceeds its recorded baseline by more than " << Headroom * 100 << "%,\n"
+                    << "or allocates superlinearly on generated blueprints.";
+
+        perf::Help("test-allocations [options] ... [<input file> ...]",
+            description.str(),
+            { { "-b, --baseline <file>", "check the input files against the baselines in file" },
+                { "-r, --record <file>", "record the allocations of the input files as baselines into file" },
+                { "--require-baselines", "fail if a stage of an input file has no baseline" },
+                { "-s, --scale <count>",
+                    "number of items of the smaller generated blueprints, 0 to skip them\n(default "
+                        + std::to_string(DefaultScale) + ")" },
+                perf::ToleranceHelp(DefaultTolerance),
+                { "-v, --verbose", "print the allocations of every check" } });
+    }
+}
+
+int main(int argc, const char* argv[])
+{
+    Options options;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+
+        if (arg == "-h" || arg == "--help") {
+            Help();
+        } else if ((arg == "-b" || arg == "--baseline") && i + 1 < argc) {
+            options.baselineFile = argv[++i];
+        } else if ((arg == "-r" || arg == "--record") && i + 1 < argc) {
+            options.recordFile = argv[++i];
+        } else if ((arg == "-s" || arg == "--scale") && i + 1 < argc) {
+            options.scale = perf::ParseCount(argv[++i]);
+        } else if ((arg == "-t" || arg == "--tolerance") && i + 1 < argc) {
+            options.tolerance = perf::ParseTolerance(argv[++i]);
+        } else if (arg == "--require-baselines") {
+            options.requireBaselines = true;
+        } else if (arg == "-v" || arg == "--verbose") {
+            options.verbose = true;
+        } else if (!arg.empty() && arg[0] == '-') {
+            std::cerr << "fatal: unknown option '" << arg << "'\n";
+            exit(EXIT_FAILURE);
+        } else {
+            options.inputs.push_back(arg);
+        }
+    }
+
+    Baselines baselines;
+
+    if (!options.baselineFile.empty())
+        ReadBaselines(options.baselineFile, baselines);
+
+    std::ofstream record;
+
+    if (!options.recordFile.empty()) {
+        record.open(options.recordFile.c_str());
+
+        if (!record.is_open()) {
+            std::cerr << "fatal: unable to open baseline file '" << options.recordFile << "'\n";
+            exit(EXIT_FAILURE);
+        }
+
+        record << "# fixture\tstage\tallocations\tbytes, recorded by test-allocations --record\n";
+    }
+
+    Results results;
+
+    for (const auto& input : options.inputs) {
+        std::string source;
+
+        if (!perf::ReadFile(input, source)) {
+            std::cerr << "fatal: unable to open input file '" << input << "'\n";
+            exit(EXIT_FAILURE);
+        }
+
+        perf::PipelineRun run = Measure(source);
+
+        if (record.is_open())
+            RecordBaselines(input, run, record);
+        else
+            CheckBaselines(input, run, baselines, options, results);
+    }
+
+    if (options.scale) {
+        for (size_t shape = 0; shape < perf::ShapeCount; ++shape) {
+            CheckScaling(static_cast<perf::BlueprintShape>(shape), options, results);
+        }
+    }
+
+    std::cerr << results.checks << " allocation checks, " << results.failures << " failed";
+
+    if (results.missingBaselines)
+        std::cerr << ", " << results.missingBaselines << " stages without a baseline";
+
+    std::cerr << "\n";
+
+    if (options.requireBaselines && results.missingBaselines)
+        return EXIT_FAILURE;
+
+    return results.failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
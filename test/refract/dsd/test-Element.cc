@@ -202,3 +202,77 @@ SCENARIO("Elements can be cloned with refract::clone(const IElement&)", "[Elemen
         }
     }
 }
+
+SCENARIO("Element counters track created and alive elements", "[Element]")
+{
+    GIVEN("The element counters of the current thread")
+    {
+        ElementCountingScope counting;
+        const ElementCounters before = elementCounters();
+
+        WHEN("an element with a member is created")
+        {
+            auto element = make_element<ObjectElement>( //
+                make_element<MemberElement>("a", from_primitive(3.0)));
+
+            THEN("the created and alive counters grow")
+            {
+                REQUIRE(elementCounters().created >= before.created + 4);
+                REQUIRE(elementCounters().alive() >= before.alive() + 4);
+                REQUIRE(elementCounters().peak >= elementCounters().alive());
+            }
+
+            WHEN("it is destroyed")
+            {
+                element.reset();
+
+                THEN("the alive counter drops back")
+                {
+                    REQUIRE(elementCounters().alive() == before.alive());
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Element counters stay still out of a counting scope", "[Element]")
+{
+    GIVEN("The element counters of the current thread")
+    {
+        const ElementCounters before = elementCounters();
+
+        WHEN("an element is created and destroyed")
+        {
+            auto element = make_element<ObjectElement>( //
+                make_element<MemberElement>("a", from_primitive(3.0)));
+            element.reset();
+
+            THEN("the counters do not change")
+            {
+                REQUIRE(elementCounters().created == before.created);
+                REQUIRE(elementCounters().destroyed == before.destroyed);
+            }
+        }
+    }
+}
+
+SCENARIO("Element counters do not underflow when destroying elements created before counting", "[Element]")
+{
+    GIVEN("An element created before counting")
+    {
+        auto element = from_primitive(3.0);
+
+        WHEN("it is destroyed while counting")
+        {
+            ElementCountingScope counting;
+            const ElementCounters before = elementCounters();
+
+            element.reset();
+
+            THEN("the alive counter goes below its previous value")
+            {
+                REQUIRE(elementCounters().alive() == before.alive() - 1);
+            }
+        }
+    }
+}
@@ -216,3 +216,80 @@ SCENARIO("InfoElementss can be copied and moved", "[InfoElements]")
         }
     }
 }
+
+SCENARIO("InfoElements above the index threshold keep insertion order and lookup", "[InfoElements]")
+{
+    GIVEN("An InfoElements with more entries than the index threshold")
+    {
+        InfoElements collection;
+        const std::size_t count = 4 * InfoElements::IndexThreshold;
+
+        for (std::size_t i = 0; i < count; ++i)
+            collection.set("key" + std::to_string(i), std::make_unique<test::ElementMock>());
+
+        THEN("its size equals the number of distinct keys")
+        {
+            REQUIRE(collection.size() == count);
+        }
+        THEN("every key is found")
+        {
+            for (std::size_t i = 0; i < count; ++i) {
+                auto it = collection.find("key" + std::to_string(i));
+                REQUIRE(it != collection.end());
+                REQUIRE(it->first == "key" + std::to_string(i));
+            }
+        }
+        THEN("an unknown key is not found")
+        {
+            REQUIRE(collection.find("unknown") == collection.end());
+        }
+        THEN("iteration follows insertion order")
+        {
+            std::size_t i = 0;
+            for (const auto& entry : collection)
+                REQUIRE(entry.first == "key" + std::to_string(i++));
+        }
+
+        WHEN("an existing key is set again")
+        {
+            auto el = new test::ElementMock();
+            collection.set("key3", std::unique_ptr<IElement>(el));
+
+            THEN("its size does not change")
+            {
+                REQUIRE(collection.size() == count);
+            }
+            THEN("the value is replaced in place")
+            {
+                REQUIRE(collection.find("key3")->second.get() == el);
+                REQUIRE(std::next(collection.begin(), 3)->second.get() == el);
+            }
+        }
+
+        WHEN("a key is erased")
+        {
+            collection.erase("key5");
+
+            THEN("it is not found anymore")
+            {
+                REQUIRE(collection.find("key5") == collection.end());
+            }
+            THEN("the following keys are still found")
+            {
+                for (std::size_t i = 6; i < count; ++i)
+                    REQUIRE(collection.find("key" + std::to_string(i))->first == "key" + std::to_string(i));
+            }
+        }
+
+        WHEN("it is copied")
+        {
+            InfoElements collection2(collection);
+
+            THEN("every key is found in the copy")
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                    REQUIRE(collection2.find("key" + std::to_string(i)) != collection2.end());
+            }
+        }
+    }
+}
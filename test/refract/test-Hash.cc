@@ -0,0 +1,150 @@
+//
+//  test/refract/test-Hash.cc
+//  test-librefract
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#include "catch.hpp"
+
+#include "refract/Element.h"
+#include "refract/Hash.h"
+
+using namespace refract;
+
+namespace
+{
+    std::unique_ptr<ObjectElement> makeObject()
+    {
+        auto obj = make_element<ObjectElement>(
+            make_element<MemberElement>("id", from_primitive(42.0)), //
+            make_element<MemberElement>("name", from_primitive("Andrew")));
+        obj->meta().set("id", from_primitive("User"));
+        obj->attributes().set("typeAttributes", make_element<ArrayElement>(from_primitive("fixed")));
+        return obj;
+    }
+}
+
+SCENARIO("Structurally equal elements hash equal", "[Element][hash]")
+{
+    GIVEN("two independently built equal objects")
+    {
+        auto first = makeObject();
+        auto second = makeObject();
+
+        THEN("their hashes equal")
+        {
+            REQUIRE(hash(*first) == hash(*second));
+        }
+
+        WHEN("one of them gets a source map attribute")
+        {
+            second->attributes().set("sourceMap", from_primitive("0:42"));
+
+            THEN("their hashes still equal")
+            {
+                REQUIRE(hash(*first) == hash(*second));
+            }
+        }
+
+        WHEN("attributes are set in different order")
+        {
+            first->attributes().set("a", from_primitive("a"));
+            first->attributes().set("b", from_primitive("b"));
+            second->attributes().set("b", from_primitive("b"));
+            second->attributes().set("a", from_primitive("a"));
+
+            THEN("their hashes still equal")
+            {
+                REQUIRE(hash(*first) == hash(*second));
+            }
+        }
+    }
+
+    GIVEN("positive and negative zero")
+    {
+        auto positive = from_primitive(0.0);
+        auto negative = from_primitive(-0.0);
+
+        THEN("their hashes equal")
+        {
+            REQUIRE(hash(*positive) == hash(*negative));
+        }
+    }
+}
+
+SCENARIO("Hashes follow modification", "[Element][hash]")
+{
+    GIVEN("two equal objects with computed hashes")
+    {
+        auto first = makeObject();
+        auto second = makeObject();
+
+        REQUIRE(hash(*first) == hash(*second));
+
+        WHEN("a nested value of one of them is modified through its ancestors")
+        {
+            auto& member = static_cast<MemberElement&>(**second->get().begin());
+            member.get().value()->meta().set("description", from_primitive("identifier"));
+
+            THEN("their hashes differ")
+            {
+                REQUIRE(hash(*first) != hash(*second));
+            }
+            THEN("they are not equal")
+            {
+                REQUIRE_FALSE(*first == *second);
+            }
+        }
+
+        WHEN("the element name of one of them is changed")
+        {
+            second->element("User");
+
+            THEN("their hashes differ")
+            {
+                REQUIRE(hash(*first) != hash(*second));
+            }
+        }
+
+        WHEN("one of them is copy assigned from a different object")
+        {
+            *second = ObjectElement{};
+
+            THEN("their hashes differ")
+            {
+                REQUIRE(hash(*first) != hash(*second));
+            }
+        }
+    }
+}
+
+SCENARIO("Hashes follow modification through references taken before hashing", "[Element][hash]")
+{
+    GIVEN("two objects differing in a member, both hashed")
+    {
+        auto first = makeObject();
+        auto second = makeObject();
+
+        first->get().push_back(make_element<MemberElement>("admin", from_primitive(true)));
+
+        auto& members = second->get();
+
+        REQUIRE(hash(*first) != hash(*second));
+        REQUIRE_FALSE(*first == *second);
+
+        WHEN("the other one gets the same member through the reference")
+        {
+            members.push_back(make_element<MemberElement>("admin", from_primitive(true)));
+
+            THEN("their hashes equal")
+            {
+                REQUIRE(hash(*first) == hash(*second));
+            }
+            THEN("they are equal")
+            {
+                REQUIRE(*first == *second);
+            }
+        }
+    }
+}
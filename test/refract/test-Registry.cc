@@ -0,0 +1,95 @@
+//
+//  test/refract/test-Registry.cc
+//  test-librefract
+//
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#include "catch.hpp"
+
+#include "refract/Element.h"
+#include "refract/Registry.h"
+
+using namespace refract;
+
+namespace
+{
+    template <typename T>
+    std::unique_ptr<T> makeNamed(const std::string& id, const std::string& parent)
+    {
+        auto element = make_empty<T>();
+        element->element(parent);
+        element->meta().set("id", from_primitive(id));
+        return element;
+    }
+}
+
+SCENARIO("Registry resolves ancestors of named types", "[Registry]")
+{
+    GIVEN("a registry with a chain of named types")
+    {
+        Registry registry;
+        registry.add(makeNamed<StringElement>("A", "string"));
+        registry.add(makeNamed<StringElement>("B", "A"));
+        registry.add(makeNamed<StringElement>("C", "B"));
+
+        THEN("named types are found by name")
+        {
+            REQUIRE(registry.find("B"));
+            REQUIRE(registry.handle("B")->id == "B");
+            REQUIRE_FALSE(registry.find("D"));
+        }
+
+        THEN("the parent of a named type is its base named type")
+        {
+            REQUIRE(registry.parent(registry.handle("C")) == registry.handle("B"));
+            REQUIRE(registry.parent(registry.handle("A")) == nullptr);
+        }
+
+        THEN("the root ancestor and base type are resolved")
+        {
+            REQUIRE(registry.root(registry.handle("C")) == registry.handle("A"));
+            REQUIRE(FindRootAncestor("C", registry) == registry.find("A"));
+            REQUIRE(registry.baseType(registry.handle("C")) == TypeQueryVisitor::String);
+        }
+
+        WHEN("the root named type is replaced")
+        {
+            registry.root(registry.handle("C"));
+
+            registry.remove("A");
+            registry.add(makeNamed<NumberElement>("A", "number"));
+
+            THEN("the root ancestor and base type follow")
+            {
+                REQUIRE(registry.root(registry.handle("C")) == registry.handle("A"));
+                REQUIRE(registry.baseType(registry.handle("C")) == TypeQueryVisitor::Number);
+            }
+        }
+
+        WHEN("the root named type is removed")
+        {
+            registry.root(registry.handle("C"));
+
+            registry.remove("A");
+
+            THEN("the chain ends at its child")
+            {
+                REQUIRE(registry.root(registry.handle("C")) == registry.handle("B"));
+            }
+        }
+    }
+
+    GIVEN("a registry with recursive inheritance")
+    {
+        Registry registry;
+        registry.add(makeNamed<ObjectElement>("A", "B"));
+        registry.add(makeNamed<ObjectElement>("B", "A"));
+
+        THEN("resolving the root ancestor terminates")
+        {
+            REQUIRE(registry.root(registry.handle("A")));
+            REQUIRE(registry.baseType(registry.handle("B")) == TypeQueryVisitor::Object);
+        }
+    }
+}
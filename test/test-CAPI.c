@@ -83,6 +83,7 @@ int test_validation()
     drafter_result* result = NULL;
 
     assert(drafter_check_blueprint(source, &result, parseOptions) == 0);
+    assert(result == NULL);
 
     int status = drafter_check_blueprint(source_warning, &result, parseOptions);
     assert(status == 0);
@@ -103,11 +104,143 @@ int test_validation()
     return 0;
 }
 
+const char* source_mson_warning = "# GET /\n+ Response 200\n    + Attributes\n        + name (default)\n";
+const char* mson_warning = "no value present when 'default' is specified";
+
+int test_validation_annotations_only()
+{
+    drafter_parse_options parseOptions = { false };
+    drafter_result* result = NULL;
+
+    assert(drafter_check_blueprint(source_mson_warning, &result, parseOptions) == 0);
+    assert(result != 0);
+
+    drafter_serialize_options options;
+    options.sourcemap = false;
+    options.format = DRAFTER_SERIALIZE_JSON;
+
+    char* out = drafter_serialize(result, options);
+    assert(out);
+
+    /* check the warning of the data structure is reported without the API description */
+    assert(strstr(out, mson_warning) != 0);
+    assert(strstr(out, "\"category\"") == 0);
+
+    drafter_free_result(result);
+    free(out);
+    return 0;
+}
+
+char* parse_components(const char* blueprint, unsigned int components)
+{
+    drafter_parse_options_ex parseOptions;
+    memset(&parseOptions, 0, sizeof(parseOptions));
+    parseOptions.size = sizeof(parseOptions);
+    parseOptions.components = components;
+
+    drafter_result* result = NULL;
+    drafter_parse_blueprint_ex(blueprint, &result, &parseOptions);
+    assert(result);
+
+    drafter_serialize_options options;
+    options.sourcemap = false;
+    options.format = DRAFTER_SERIALIZE_JSON;
+
+    char* out = drafter_serialize(result, options);
+    assert(out);
+
+    drafter_free_result(result);
+    return out;
+}
+
+int test_parse_components()
+{
+    char* out = parse_components(source_mson_warning, DRAFTER_COMPONENT_RESOURCES | DRAFTER_COMPONENT_ANNOTATIONS);
+
+    assert(strstr(out, "\"resource\"") != 0);
+    assert(strstr(out, "\"transition\"") == 0);
+    free(out);
+
+    /* resources are produced as containers of the transitions */
+    out = parse_components(source_mson_warning, DRAFTER_COMPONENT_TRANSITIONS);
+
+    assert(strstr(out, "\"resource\"") != 0);
+    assert(strstr(out, "\"transition\"") != 0);
+    assert(strstr(out, "\"annotation\"") == 0);
+    free(out);
+
+    return 0;
+}
+
+int test_parse_stats()
+{
+    drafter_parse_stats stats;
+    drafter_parse_options_ex parseOptions;
+    memset(&parseOptions, 0, sizeof(parseOptions));
+    parseOptions.size = sizeof(parseOptions);
+    parseOptions.stats = &stats;
+
+    drafter_result* result = NULL;
+
+    int status = drafter_parse_blueprint_ex(source_warning, &result, &parseOptions);
+    assert(status == 0);
+    assert(result);
+
+    assert(stats.resourceCount == 1);
+    assert(stats.actionCount == 1);
+    assert(stats.dataStructureCount == 0);
+    assert(stats.annotationCount == 1);
+    assert(stats.elementCount > 0);
+    assert(stats.elementsCreated >= stats.elementCount);
+    assert(stats.peakElements >= stats.elementCount);
+
+    for (int stage = 0; stage < DRAFTER_STAGE_COUNT; ++stage) {
+        assert(stats.stageTime[stage] >= 0);
+    }
+
+    assert(stats.stageTime[DRAFTER_STAGE_MARKDOWN] > 0);
+    assert(stats.stageTime[DRAFTER_STAGE_SERIALIZATION] == 0);
+
+    drafter_free_result(result);
+
+    return 0;
+}
+
+int test_parse_options_size()
+{
+    const char* source_tab = "# My API\n## GET /message\n + Response 200 (text/plain)\n\n\tHello World\n";
+
+    drafter_parse_stats stats;
+    stats.resourceCount = 42;
+
+    /* a caller built against a version without the stats option */
+    drafter_parse_options_ex parseOptions;
+    memset(&parseOptions, 0, sizeof(parseOptions));
+    parseOptions.size = offsetof(drafter_parse_options_ex, stats);
+    parseOptions.normalizeSource = true;
+    parseOptions.stats = &stats;
+
+    drafter_result* result = NULL;
+
+    int status = drafter_parse_blueprint_ex(source_tab, &result, &parseOptions);
+    assert(status == 0);
+    assert(result);
+    assert(stats.resourceCount == 42);
+
+    drafter_free_result(result);
+
+    return 0;
+}
+
 int main()
 {
     assert(test_parse_and_serialize() == 0);
     assert(test_parse_to_string() == 0);
     assert(test_version() == 0);
     assert(test_validation() == 0);
+    assert(test_validation_annotations_only() == 0);
+    assert(test_parse_components() == 0);
+    assert(test_parse_stats() == 0);
+    assert(test_parse_options_size() == 0);
     return 0;
 }
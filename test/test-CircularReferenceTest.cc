@@ -15,3 +15,48 @@ TEST_REFRACT("circular", "mixin-member");
 TEST_REFRACT("circular", "mixin-embed");
 TEST_REFRACT("circular", "mixin-cross");
 TEST_REFRACT("circular", "mixed");
+
+SCENARIO("Named type dependency cycles are recorded", "[circular][dependencies]")
+{
+    GIVEN("a blueprint with mutually recursive named types")
+    {
+        snowcrash::ParseResult<snowcrash::Blueprint> blueprint;
+        snowcrash::parse(ITFixtureFiles("test/fixtures/circular/cross").get(ext::apib), 0, blueprint);
+
+        drafter::WrapperOptions options;
+        drafter::ConversionContext context(options);
+
+        WHEN("it is converted")
+        {
+            WrapRefract(blueprint, context);
+
+            const auto& dependencies = context.GetNamedTypeDependencies();
+
+            THEN("the types are ordered by name")
+            {
+                REQUIRE(dependencies.names.size() == 2);
+                REQUIRE(dependencies.names[0] == "A");
+                REQUIRE(dependencies.names[1] == "B");
+            }
+
+            THEN("each type depends on the other")
+            {
+                REQUIRE(dependencies.dependencies[0] == drafter::NamedTypeDependencies::Indexes{ 1 });
+                REQUIRE(dependencies.dependencies[1] == drafter::NamedTypeDependencies::Indexes{ 0 });
+            }
+
+            THEN("the cycle is recorded starting with the first type by name")
+            {
+                REQUIRE(dependencies.cycles.size() == 1);
+                REQUIRE(dependencies.cycles[0] == (drafter::NamedTypeDependencies::Indexes{ 0, 1 }));
+            }
+
+            THEN("both types are recursive")
+            {
+                REQUIRE(dependencies.isRecursive(0));
+                REQUIRE(dependencies.isRecursive(1));
+                REQUIRE(dependencies.resolved.components().size() == 1);
+            }
+        }
+    }
+}
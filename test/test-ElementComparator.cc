@@ -195,6 +195,49 @@ SCENARIO("Compare equality of elements with sourceMaps", "[Element][comparator][
     }
 }
 
+SCENARIO("Compare equality of elements regardless of info element order", "[Element][comparator][equal]")
+{
+    GIVEN("Two empty primitive elements with same attributes set in different order")
+    {
+
+        auto first = make_element<S>();
+        auto second = make_element<S>();
+
+        for (int i = 0; i < 20; ++i) {
+            first->attributes().set("a" + std::to_string(i), from_primitive(std::to_string(i)));
+            second->attributes().set("a" + std::to_string(19 - i), from_primitive(std::to_string(19 - i)));
+        }
+
+        WHEN("it is compared")
+        {
+            THEN("it is recognized as equal")
+            {
+                REQUIRE(true == Equal(*first, *second));
+            }
+        }
+
+        WHEN("one attribute value differs")
+        {
+            second->attributes().set("a7", from_primitive("x"));
+
+            THEN("it is recognized as non-equal")
+            {
+                REQUIRE(false == Equal(*first, *second));
+            }
+        }
+
+        WHEN("one attribute is missing")
+        {
+            second->attributes().erase("a7");
+
+            THEN("it is recognized as non-equal")
+            {
+                REQUIRE(false == Equal(*first, *second));
+            }
+        }
+    }
+}
+
 SCENARIO("Compare equality of elements with custom keywordlist", "[Element][comparator][equal]")
 {
     struct IgnoreFooAndBarAttribute {
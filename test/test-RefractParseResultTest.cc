@@ -7,6 +7,9 @@
 //
 
 #include "draftertest.h"
+#include "drafter.h"
+
+#include "refract/TypeQueryVisitor.h"
 
 using namespace draftertest;
 
@@ -18,4 +21,158 @@ TEST_REFRACT("parse-result", "blueprint");
 TEST_REFRACT("parse-result", "mson");
 
 TEST_REFRACT("mson", "type-attributes");
-TEST_REFRACT("mson", "type-attributes-payload");
\ No newline at end of file
+TEST_REFRACT("mson", "type-attributes-payload");
+SCENARIO("Conversion warnings are deduplicated", "[parse-result][warnings]")
+{
+    GIVEN("a conversion context")
+    {
+        drafter::WrapperOptions options;
+        drafter::ConversionContext context(options);
+
+        mdp::CharactersRangeSet location;
+        location.push_back(mdp::CharactersRange(4, 2));
+
+        WHEN("the same warning is added twice")
+        {
+            context.warn("unexpected value", snowcrash::MSONError, location);
+            context.warn("unexpected value", snowcrash::MSONError, location);
+
+            THEN("it is kept once")
+            {
+                REQUIRE(context.GetWarnings().size() == 1);
+            }
+        }
+
+        WHEN("warnings differing in location or message are added")
+        {
+            context.warn("unexpected value", snowcrash::MSONError, location);
+            context.warn("unexpected value", snowcrash::MSONError);
+            context.warn("missing value", snowcrash::MSONError, location);
+
+            THEN("all of them are kept in order")
+            {
+                const auto& warnings = context.GetWarnings();
+
+                REQUIRE(warnings.size() == 3);
+                REQUIRE(warnings[0].location.size() == 1);
+                REQUIRE(warnings[1].location.empty());
+                REQUIRE(warnings[2].text() == "missing value");
+            }
+
+            THEN("they can be taken out of the context")
+            {
+                snowcrash::Warnings warnings = context.TakeWarnings();
+
+                REQUIRE(warnings.size() == 3);
+                REQUIRE(warnings[0].message == "unexpected value");
+                REQUIRE(warnings[0].location.size() == 1);
+                REQUIRE(warnings[2].message == "missing value");
+                REQUIRE(context.GetWarnings().empty());
+
+                context.warn("missing value", snowcrash::MSONError, location);
+                REQUIRE(context.GetWarnings().size() == 1);
+            }
+        }
+
+        WHEN("warnings differing only in their detail are added")
+        {
+            const std::string message = "unable to render. ";
+
+            context.warn("unable to render. ", snowcrash::ApplicationError, location, "first");
+            context.warn("unable to render. ", snowcrash::ApplicationError, location, "second");
+            context.warn(message.c_str(), snowcrash::ApplicationError, location, "first");
+
+            THEN("they are kept once per detail and formatted with the detail appended")
+            {
+                snowcrash::Warnings warnings = context.TakeWarnings();
+
+                REQUIRE(warnings.size() == 2);
+                REQUIRE(warnings[0].message == "unable to render. first");
+                REQUIRE(warnings[1].message == "unable to render. second");
+            }
+        }
+    }
+}
+
+namespace
+{
+    /// Serialize the annotations of the parse result, without the warnings of the rendering
+    std::string SerializeAnnotations(const drafter_result* result)
+    {
+        refract::ArrayElement annotations;
+        annotations.element(drafter::SerializeKey::ParseResult);
+
+        const auto parseResult = refract::TypeQueryVisitor::as<const refract::ArrayElement>(result);
+        REQUIRE(parseResult);
+
+        for (const auto& element : parseResult->get()) {
+            if (element->element() != drafter::SerializeKey::Annotation)
+                continue;
+
+            const auto message = refract::TypeQueryVisitor::as<const refract::StringElement>(element.get());
+
+            // Message bodies and schemas are not rendered by drafter_check_blueprint
+            if (message && message->get().get().compare(0, 16, "unable to render") == 0)
+                continue;
+
+            annotations.get().push_back(element->clone());
+        }
+
+        drafter_serialize_options options{ true, DRAFTER_SERIALIZE_JSON };
+        char* out = drafter_serialize(&annotations, options);
+        REQUIRE(out);
+
+        std::string serialized(out);
+        free(out);
+
+        return serialized;
+    }
+}
+
+SCENARIO("Checking a blueprint reports the annotations of parsing it", "[parse-result][warnings]")
+{
+    const char* fixtures[] = { "parse-result/warning",
+        "parse-result/warnings",
+        "parse-result/error",
+        "parse-result/error-warning",
+        "api/request-only",
+        "circular/mixin-cross",
+        "mson/check-bool-number-value-validity",
+        "mson/check-default-without-value",
+        "mson/check-sample-without-value",
+        "mson/enum-multiple-default",
+        "mson/mixin-nonexistent",
+        "mson/number-wrong-value",
+        "mson/resource-unresolved-reference",
+        "mson/type-attributes-payload",
+        "render/issue-318" };
+
+    for (const char* fixture : fixtures) {
+        GIVEN(std::string("the blueprint of the ") + fixture + " fixture")
+        {
+            const std::string source = ITFixtureFiles(std::string("test/fixtures/") + fixture).get(ext::apib);
+            drafter_parse_options options{ false };
+
+            drafter_result* parsed = nullptr;
+            const drafter_error parseStatus = drafter_parse_blueprint(source.c_str(), &parsed, options);
+            REQUIRE(parsed);
+
+            WHEN("it is checked")
+            {
+                drafter_result* checked = nullptr;
+                const drafter_error checkStatus = drafter_check_blueprint(source.c_str(), &checked, options);
+
+                THEN("the status and the annotations are the same as of parsing it")
+                {
+                    REQUIRE(checkStatus == parseStatus);
+                    REQUIRE(checked);
+                    REQUIRE(SerializeAnnotations(checked) == SerializeAnnotations(parsed));
+                }
+
+                drafter_free_result(checked);
+            }
+
+            drafter_free_result(parsed);
+        }
+    }
+}
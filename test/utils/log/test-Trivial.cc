@@ -0,0 +1,198 @@
+//
+//  test/utils/log/test-Trivial.cc
+//  test-librefract
+//
+//  Created by Thomas Jandecka on 16/02/2018
+//  Copyright (c) 2018 Apiary Inc. All rights reserved.
+//
+
+#include <catch.hpp>
+
+#include "utils/log/Trivial.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace drafter;
+using namespace utils;
+using namespace log;
+
+namespace
+{
+    const char* const LogPath = "test-trivial.log";
+
+    std::string readLog()
+    {
+        std::ifstream in(LogPath);
+        std::stringstream content;
+        content << in.rdbuf();
+        return content.str();
+    }
+
+    size_t countLines(const std::string& s)
+    {
+        size_t lines = 0;
+
+        for (char c : s)
+            if (c == '\n')
+                ++lines;
+
+        return lines;
+    }
+
+    /// Logs an entry of its own when formatted into another entry
+    struct Nested {
+        trivial_log& log;
+    };
+
+    std::ostream& operator<<(std::ostream& out, const Nested& nested)
+    {
+        trivial_entry<error>{ nested.log, 2, "inner" } << "inner entry";
+        return out << "outer entry";
+    }
+}
+
+TEST_CASE("LOG is a single statement", "[log]")
+{
+    bool logged = true;
+    int evaluated = 0;
+
+    if (logged)
+        LOG(error) << ++evaluated;
+    else
+        logged = false;
+
+    REQUIRE(logged);
+
+    // Logging is not enabled in the tests
+    REQUIRE(evaluated == 0);
+}
+
+TEST_CASE("Flush queued entries in order", "[log]")
+{
+    {
+        trivial_log log(LogPath);
+
+        trivial_entry<error>{ log, 1, "file" } << "first";
+        trivial_entry<warning>{ log, 2, "file" } << "second";
+
+        REQUIRE(readLog().empty());
+
+        log.flush();
+
+        const std::string content = readLog();
+
+        REQUIRE(countLines(content) == 2);
+        REQUIRE(content.find("[ERROR]") == 0);
+        REQUIRE(content.find("[file:1] first\n") != std::string::npos);
+        REQUIRE(content.find("[file:2] second\n") > content.find("[file:1] first\n"));
+    }
+
+    std::remove(LogPath);
+}
+
+TEST_CASE("Write nested entries whole", "[log]")
+{
+    {
+        trivial_log log(LogPath);
+
+        trivial_entry<error>{ log, 1, "outer" } << Nested{ log };
+        log.flush();
+
+        const std::string content = readLog();
+
+        // The nested entry is done first
+        REQUIRE(countLines(content) == 2);
+        REQUIRE(content.find("[inner:2] inner entry\n") != std::string::npos);
+        REQUIRE(content.find("[outer:1] outer entry\n") > content.find("[inner:2] inner entry\n"));
+    }
+
+    std::remove(LogPath);
+}
+
+TEST_CASE("Writer drains entries of all threads", "[log]")
+{
+    const int threadCount = 4;
+    const int entryCount = 1000;
+
+    {
+        trivial_log log(LogPath);
+        log.start();
+
+        std::vector<std::thread> threads;
+
+        for (int t = 0; t < threadCount; ++t) {
+            threads.emplace_back([&log, t]() {
+                for (int i = 0; i < entryCount; ++i)
+                    trivial_entry<info>{ log, static_cast<size_t>(i), "thread" } << t;
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        // Written by the writer within its interval, without flushing
+        std::string content;
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+        while (countLines(content = readLog()) < threadCount * entryCount
+            && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        REQUIRE(countLines(content) == threadCount * entryCount);
+    }
+
+    std::remove(LogPath);
+}
+
+TEST_CASE("Write queued entries when the log is destroyed", "[log]")
+{
+    {
+        trivial_log log(LogPath);
+        log.start();
+
+        trivial_entry<error>{ log, 1, "file" } << "last";
+    }
+
+    REQUIRE(readLog().find("[file:1] last\n") != std::string::npos);
+
+    std::remove(LogPath);
+}
+
+TEST_CASE("Keep the entries of logs used by the same thread apart", "[log]")
+{
+    const char* const OtherPath = "test-trivial-other.log";
+
+    {
+        trivial_log log(LogPath);
+        trivial_log other(OtherPath);
+
+        trivial_entry<error>{ log, 1, "file" } << "first";
+        trivial_entry<error>{ other, 2, "file" } << "other";
+        trivial_entry<error>{ log, 3, "file" } << "second";
+
+        log.flush();
+        other.flush();
+
+        const std::string content = readLog();
+
+        REQUIRE(countLines(content) == 2);
+        REQUIRE(content.find("[file:3] second\n") > content.find("[file:1] first\n"));
+        REQUIRE(content.find("other") == std::string::npos);
+
+        std::ifstream in(OtherPath);
+        std::stringstream otherContent;
+        otherContent << in.rdbuf();
+
+        REQUIRE(otherContent.str().find("[file:2] other\n") != std::string::npos);
+    }
+
+    std::remove(LogPath);
+    std::remove(OtherPath);
+}